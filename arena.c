@@ -1,6 +1,13 @@
 #include "arena.h"
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+
+#define ARENA_BLOCK_HEADER_SIZE ((sizeof(ArenaBlock) + 15) & ~(size_t)15)
+
+static char* block_data(ArenaBlock *block) {
+    return (char*)block + ARENA_BLOCK_HEADER_SIZE;
+}
 
 const char* arena_error_string(ArenaResult result) {
     switch (result) {
@@ -25,6 +32,8 @@ ArenaResult arena_create(Arena *arena, size_t size) {
     arena->total_size = size;
     arena->used_size = 0;
     arena->owns_memory = true;
+    arena->block = NULL;
+    arena->max_size = 0;
     
     return ARENA_OK;
 }
@@ -39,13 +48,110 @@ ArenaResult arena_create_with_buffer(Arena *arena, void *buffer, size_t size) {
     arena->total_size = size;
     arena->used_size = 0;
     arena->owns_memory = false;
+    arena->block = NULL;
+    arena->max_size = 0;
+    
+    return ARENA_OK;
+}
+
+static void use_block(Arena *arena, ArenaBlock *block) {
+    arena->block = block;
+    arena->memory = block_data(block);
+    arena->current = arena->memory;
+    arena->end = arena->memory + block->size;
+}
+
+ArenaResult arena_create_growable(Arena *arena, size_t initial_size, size_t max_size) {
+    if (!arena) return ARENA_ERROR_NULL_POINTER;
+    if (initial_size == 0) return ARENA_ERROR_INVALID_SIZE;
+    if (max_size > 0 && initial_size > max_size) return ARENA_ERROR_INVALID_SIZE;
+    if (initial_size > SIZE_MAX - ARENA_BLOCK_HEADER_SIZE) return ARENA_ERROR_INVALID_SIZE;
+    
+    ArenaBlock *block = malloc(ARENA_BLOCK_HEADER_SIZE + initial_size);
+    if (!block) return ARENA_ERROR_MEMORY_ALLOCATION;
+    block->prev = NULL;
+    block->size = initial_size;
+    
+    use_block(arena, block);
+    arena->total_size = initial_size;
+    arena->used_size = 0;
+    arena->owns_memory = true;
+    arena->max_size = max_size;
     
     return ARENA_OK;
 }
 
+bool arena_is_growable(const Arena *arena) {
+    return arena && arena->block != NULL;
+}
+
+/*
+ * Chains a new block large enough for min_size bytes. Blocks double in
+ * size so a long run of allocations needs only a logarithmic number of
+ * mallocs; with a cap the last block is trimmed to the remaining budget.
+ */
+static ArenaResult arena_grow(Arena *arena, size_t min_size) {
+    size_t size = arena->block->size;
+    size = (size > SIZE_MAX / 2) ? SIZE_MAX : size * 2;
+    if (size < min_size) size = min_size;
+    
+    if (arena->max_size > 0) {
+        size_t budget = arena->max_size > arena->total_size ? arena->max_size - arena->total_size : 0;
+        if (min_size > budget) return ARENA_ERROR_OUT_OF_MEMORY;
+        if (size > budget) size = budget;
+    }
+    if (size > SIZE_MAX - ARENA_BLOCK_HEADER_SIZE) return ARENA_ERROR_OUT_OF_MEMORY;
+    
+    ArenaBlock *block = malloc(ARENA_BLOCK_HEADER_SIZE + size);
+    if (!block) return ARENA_ERROR_MEMORY_ALLOCATION;
+    block->prev = arena->block;
+    block->size = size;
+    
+    use_block(arena, block);
+    arena->total_size += size;
+    return ARENA_OK;
+}
+
+static bool block_in_chain(const Arena *arena, const ArenaBlock *target) {
+    for (ArenaBlock *block = arena->block; block; block = block->prev) {
+        if (block == target) return true;
+    }
+    return false;
+}
+
+/* Frees every block newer than target and makes target current again. */
+static void rewind_to_block(Arena *arena, ArenaBlock *target) {
+    while (arena->block != target) {
+        ArenaBlock *prev = arena->block->prev;
+        arena->total_size -= arena->block->size;
+        free(arena->block);
+        arena->block = prev;
+    }
+    arena->memory = block_data(target);
+    arena->end = arena->memory + target->size;
+}
+
 void arena_reset(Arena *arena) {
     if (!arena || !arena->memory) return;
     
+    if (arena->block) {
+        ArenaBlock *largest = arena->block;
+        for (ArenaBlock *block = arena->block->prev; block; block = block->prev) {
+            if (block->size > largest->size) largest = block;
+        }
+        
+        ArenaBlock *block = arena->block;
+        while (block) {
+            ArenaBlock *prev = block->prev;
+            if (block != largest) free(block);
+            block = prev;
+        }
+        
+        largest->prev = NULL;
+        use_block(arena, largest);
+        arena->total_size = largest->size;
+    }
+    
     arena->current = arena->memory;
     arena->used_size = 0;
 }
@@ -53,7 +159,14 @@ void arena_reset(Arena *arena) {
 void arena_destroy(Arena *arena) {
     if (!arena) return;
     
-    if (arena->memory && arena->owns_memory) {
+    if (arena->block) {
+        ArenaBlock *block = arena->block;
+        while (block) {
+            ArenaBlock *prev = block->prev;
+            free(block);
+            block = prev;
+        }
+    } else if (arena->memory && arena->owns_memory) {
         free(arena->memory);
     }
     
@@ -64,14 +177,21 @@ ArenaResult arena_alloc(Arena *arena, size_t size, void **ptr) {
     if (!arena || !ptr) return ARENA_ERROR_NULL_POINTER;
     if (!arena->memory) return ARENA_ERROR_NULL_POINTER;
     if (size == 0) return ARENA_ERROR_INVALID_SIZE;
-    
-    size_t aligned_size = (size + 7) & ~7;
-    
-    if (arena->current + aligned_size > arena->end) {
+    if (size > SIZE_MAX - 7) {
         *ptr = NULL;
         return ARENA_ERROR_OUT_OF_MEMORY;
     }
     
+    size_t aligned_size = (size + 7) & ~(size_t)7;
+    
+    if (aligned_size > (size_t)(arena->end - arena->current)) {
+        ArenaResult result = arena->block ? arena_grow(arena, aligned_size) : ARENA_ERROR_OUT_OF_MEMORY;
+        if (result != ARENA_OK) {
+            *ptr = NULL;
+            return result;
+        }
+    }
+    
     *ptr = arena->current;
     arena->current += aligned_size;
     arena->used_size += aligned_size;
@@ -107,6 +227,17 @@ void* arena_realloc(Arena *arena, void *ptr, size_t old_size, size_t new_size) {
         return ptr;
     }
     
+    /* The most recent allocation grows in place while its block has room. */
+    size_t old_aligned = (old_size + 7) & ~(size_t)7;
+    if (new_size <= SIZE_MAX - 7 && (char*)ptr + old_aligned == arena->current) {
+        size_t extra = ((new_size + 7) & ~(size_t)7) - old_aligned;
+        if (extra <= (size_t)(arena->end - arena->current)) {
+            arena->current += extra;
+            arena->used_size += extra;
+            return ptr;
+        }
+    }
+    
     void *new_ptr;
     ArenaResult result = arena_alloc(arena, new_size, &new_ptr);
     if (result != ARENA_OK) return NULL;
@@ -118,6 +249,48 @@ void* arena_realloc(Arena *arena, void *ptr, size_t old_size, size_t new_size) {
     return new_ptr;
 }
 
+void* arena_reserve(Arena *arena, size_t size, size_t *available) {
+    if (!arena || !arena->memory || size == 0) return NULL;
+    if (size > SIZE_MAX - 7) return NULL;
+    
+    size_t aligned_size = (size + 7) & ~(size_t)7;
+    if (aligned_size > (size_t)(arena->end - arena->current)) {
+        if (!arena->block || arena_grow(arena, aligned_size) != ARENA_OK) return NULL;
+    }
+    
+    if (available) *available = (size_t)(arena->end - arena->current);
+    return arena->current;
+}
+
+void* arena_grow_reservation(Arena *arena, void *reserved, size_t used, size_t size, size_t *available) {
+    if (!arena || !reserved || reserved != arena->current) return NULL;
+    if (used > size || size > SIZE_MAX - 7) return NULL;
+    
+    size_t aligned_size = (size + 7) & ~(size_t)7;
+    if (aligned_size > (size_t)(arena->end - arena->current)) {
+        if (!arena->block || arena_grow(arena, aligned_size) != ARENA_OK) return NULL;
+        if (used > 0) memcpy(arena->current, reserved, used);
+    }
+    
+    if (available) *available = (size_t)(arena->end - arena->current);
+    return arena->current;
+}
+
+ArenaResult arena_commit(Arena *arena, void *reserved, size_t size) {
+    if (!arena || !reserved) return ARENA_ERROR_NULL_POINTER;
+    if (reserved != arena->current) return ARENA_ERROR_INVALID_SIZE;
+    
+    size_t remaining = (size_t)(arena->end - arena->current);
+    if (size > remaining) return ARENA_ERROR_OUT_OF_MEMORY;
+    
+    size_t aligned_size = (size + 7) & ~(size_t)7;
+    if (aligned_size > remaining) aligned_size = remaining;
+    
+    arena->current += aligned_size;
+    arena->used_size += aligned_size;
+    return ARENA_OK;
+}
+
 size_t arena_get_used_size(const Arena *arena) {
     if (!arena) return 0;
     return arena->used_size;
@@ -125,14 +298,18 @@ size_t arena_get_used_size(const Arena *arena) {
 
 size_t arena_get_free_size(const Arena *arena) {
     if (!arena || !arena->memory) return 0;
-    return arena->total_size - arena->used_size;
+    return (size_t)(arena->end - arena->current);
 }
 
 bool arena_can_allocate(const Arena *arena, size_t size) {
     if (!arena || !arena->memory) return false;
+    if (size > SIZE_MAX - 7) return false;
     
-    size_t aligned_size = (size + 7) & ~7;
-    return (arena->current + aligned_size <= arena->end);
+    size_t aligned_size = (size + 7) & ~(size_t)7;
+    if (aligned_size <= (size_t)(arena->end - arena->current)) return true;
+    if (!arena->block) return false;
+    return arena->max_size == 0 ||
+           (arena->max_size > arena->total_size && aligned_size <= arena->max_size - arena->total_size);
 }
 
 ArenaRegion arena_begin_region(Arena *arena) {
@@ -141,28 +318,35 @@ ArenaRegion arena_begin_region(Arena *arena) {
         region.arena = arena;
         region.checkpoint = arena->current;
         region.used_at_checkpoint = arena->used_size;
+        region.block = arena->block;
     }
     return region;
 }
 
 void arena_end_region(ArenaRegion *region) {
-    if (!region || !region->arena) return;
-    
-    region->arena->current = region->checkpoint;
-    region->arena->used_size = region->used_at_checkpoint;
+    arena_restore_region(region);
 }
 
 ArenaResult arena_restore_region(ArenaRegion *region) {
     if (!region || !region->arena) return ARENA_ERROR_NULL_POINTER;
     if (!region->checkpoint) return ARENA_ERROR_INVALID_SIZE;
     
-    if (region->checkpoint < region->arena->memory || 
-        region->checkpoint > region->arena->end) {
+    Arena *arena = region->arena;
+    if (region->block) {
+        if (!block_in_chain(arena, region->block)) return ARENA_ERROR_INVALID_SIZE;
+        
+        char *data = block_data(region->block);
+        if (region->checkpoint < data || region->checkpoint > data + region->block->size) {
+            return ARENA_ERROR_INVALID_SIZE;
+        }
+        rewind_to_block(arena, region->block);
+    } else if (region->checkpoint < arena->memory || 
+               region->checkpoint > arena->end) {
         return ARENA_ERROR_INVALID_SIZE;
     }
     
-    region->arena->current = region->checkpoint;
-    region->arena->used_size = region->used_at_checkpoint;
+    arena->current = region->checkpoint;
+    arena->used_size = region->used_at_checkpoint;
     return ARENA_OK;
 } 
 
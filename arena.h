@@ -6,6 +6,11 @@
 
 #define ARENA_DEFAULT_SIZE (1024 * 1024)
 
+typedef struct ArenaBlock {
+    struct ArenaBlock *prev;
+    size_t size;
+} ArenaBlock;
+
 typedef struct {
     char *memory;
     char *current;
@@ -13,6 +18,8 @@ typedef struct {
     size_t total_size;
     size_t used_size;
     bool owns_memory;
+    ArenaBlock *block;
+    size_t max_size;
 } Arena;
 
 typedef enum {
@@ -25,6 +32,13 @@ typedef enum {
 
 ArenaResult arena_create(Arena *arena, size_t size);
 ArenaResult arena_create_with_buffer(Arena *arena, void *buffer, size_t size);
+/*
+ * A growable arena chains a new block, twice the size of the previous one,
+ * whenever an allocation does not fit; max_size caps the combined size of
+ * all blocks (0 for no cap). arena_reset keeps only the largest block.
+ */
+ArenaResult arena_create_growable(Arena *arena, size_t initial_size, size_t max_size);
+bool arena_is_growable(const Arena *arena);
 void arena_reset(Arena *arena);
 void arena_destroy(Arena *arena);
 
@@ -32,6 +46,18 @@ ArenaResult arena_alloc(Arena *arena, size_t size, void **ptr);
 char* arena_strdup(Arena *arena, const char *str);
 void* arena_realloc(Arena *arena, void *ptr, size_t old_size, size_t new_size);
 
+/*
+ * Reserve/commit for buffers of unknown final size. arena_reserve returns
+ * at least size writable bytes at the top of the arena without allocating
+ * them; *available reports the full room, which may be used freely. When
+ * it runs out, arena_grow_reservation moves the first used bytes to a new
+ * block (growable arenas only). arena_commit allocates the final size.
+ * The arena must not be used for anything else until the commit.
+ */
+void* arena_reserve(Arena *arena, size_t size, size_t *available);
+void* arena_grow_reservation(Arena *arena, void *reserved, size_t used, size_t size, size_t *available);
+ArenaResult arena_commit(Arena *arena, void *reserved, size_t size);
+
 size_t arena_get_used_size(const Arena *arena);
 size_t arena_get_free_size(const Arena *arena);
 bool arena_can_allocate(const Arena *arena, size_t size);
@@ -41,6 +67,7 @@ typedef struct {
     Arena *arena;
     char *checkpoint;
     size_t used_at_checkpoint;
+    ArenaBlock *block;
 } ArenaRegion;
 
 ArenaRegion arena_begin_region(Arena *arena);
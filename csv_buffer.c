@@ -0,0 +1,446 @@
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE
+
+#include "csv_buffer.h"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+const char* csv_buffer_error_string(CSVBufferResult result) {
+    switch (result) {
+        case CSV_BUFFER_OK: return "Success";
+        case CSV_BUFFER_ERROR_NULL_POINTER: return "Null pointer error";
+        case CSV_BUFFER_ERROR_MEMORY_ALLOCATION: return "Memory allocation failed";
+        case CSV_BUFFER_ERROR_FILE_OPEN: return "Failed to open file";
+        case CSV_BUFFER_ERROR_FILE_READ: return "Failed to read from file";
+        case CSV_BUFFER_ERROR_FILE_SEEK: return "Failed to seek in file";
+        case CSV_BUFFER_ERROR_UNSUPPORTED: return "Operation not supported for this file";
+        default: return "Unknown error";
+    }
+}
+
+static void reset_window(CSVBuffer *buffer, off_t offset) {
+    buffer->start = 0;
+    buffer->end = 0;
+    buffer->scan_pos = 0;
+    buffer->scan_in_quotes = false;
+    buffer->quote_mark = (CSVByteMark){0, 0};
+    buffer->cr_mark = (CSVByteMark){0, 0};
+    buffer->data_offset = offset;
+    buffer->eof = false;
+    buffer->error = CSV_BUFFER_OK;
+}
+
+CSVBufferResult csv_buffer_open(CSVBuffer *buffer, const char *path, size_t capacity) {
+    if (!buffer || !path) return CSV_BUFFER_ERROR_NULL_POINTER;
+
+    memset(buffer, 0, sizeof(CSVBuffer));
+    buffer->fd = -1;
+
+    if (capacity == 0) capacity = CSV_BUFFER_DEFAULT_SIZE;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return CSV_BUFFER_ERROR_FILE_OPEN;
+
+    buffer->data = malloc(capacity + 1);
+    if (!buffer->data) {
+        close(fd);
+        return CSV_BUFFER_ERROR_MEMORY_ALLOCATION;
+    }
+
+    buffer->fd = fd;
+    buffer->capacity = capacity;
+    reset_window(buffer, 0);
+    return CSV_BUFFER_OK;
+}
+
+CSVBufferResult csv_buffer_open_mapped(CSVBuffer *buffer, const char *path) {
+    if (!buffer || !path) return CSV_BUFFER_ERROR_NULL_POINTER;
+
+    memset(buffer, 0, sizeof(CSVBuffer));
+    buffer->fd = -1;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return CSV_BUFFER_ERROR_FILE_OPEN;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0 ||
+        (unsigned long long)st.st_size > (unsigned long long)(size_t)-1) {
+        close(fd);
+        return CSV_BUFFER_ERROR_UNSUPPORTED;
+    }
+
+    size_t size = (size_t)st.st_size;
+    void *mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED) {
+        close(fd);
+        return CSV_BUFFER_ERROR_UNSUPPORTED;
+    }
+
+    posix_madvise(mapping, size, POSIX_MADV_SEQUENTIAL);
+    posix_madvise(mapping, size, POSIX_MADV_WILLNEED);
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    madvise(mapping, size, MADV_HUGEPAGE);
+#endif
+
+    buffer->fd = fd;
+    buffer->data = mapping;
+    buffer->capacity = size;
+    buffer->source = CSV_BUFFER_SOURCE_MMAP;
+    reset_window(buffer, 0);
+    buffer->end = size;
+    buffer->eof = true;
+    return CSV_BUFFER_OK;
+}
+
+CSVBufferResult csv_buffer_open_memory(CSVBuffer *buffer, const char *data, size_t length) {
+    if (!buffer || !data) return CSV_BUFFER_ERROR_NULL_POINTER;
+
+    memset(buffer, 0, sizeof(CSVBuffer));
+    buffer->fd = -1;
+    buffer->data = (char*)data;
+    buffer->capacity = length;
+    buffer->source = CSV_BUFFER_SOURCE_MEMORY;
+    reset_window(buffer, 0);
+    buffer->end = length;
+    buffer->eof = true;
+    return CSV_BUFFER_OK;
+}
+
+CSVBufferResult csv_buffer_start_readahead(CSVBuffer *buffer, int buffer_count, size_t buffer_size) {
+    if (!csv_buffer_is_open(buffer)) return CSV_BUFFER_ERROR_NULL_POINTER;
+    if (buffer->source != CSV_BUFFER_SOURCE_READ) return CSV_BUFFER_ERROR_UNSUPPORTED;
+    if (buffer->readahead) return CSV_BUFFER_OK;
+    if (buffer->uring) return CSV_BUFFER_ERROR_UNSUPPORTED;
+
+    off_t offset = buffer->data_offset + (off_t)buffer->end;
+    CSVReadAheadResult result = csv_readahead_start(&buffer->readahead, buffer->fd, offset, buffer_count, buffer_size);
+    if (result == CSV_READAHEAD_ERROR_MEMORY_ALLOCATION) return CSV_BUFFER_ERROR_MEMORY_ALLOCATION;
+    if (result != CSV_READAHEAD_OK) return CSV_BUFFER_ERROR_UNSUPPORTED;
+    return CSV_BUFFER_OK;
+}
+
+CSVBufferResult csv_buffer_start_uring(CSVBuffer *buffer, int queue_depth, size_t buffer_size) {
+    if (!csv_buffer_is_open(buffer)) return CSV_BUFFER_ERROR_NULL_POINTER;
+    if (buffer->source != CSV_BUFFER_SOURCE_READ || buffer->readahead) return CSV_BUFFER_ERROR_UNSUPPORTED;
+    if (buffer->uring) return CSV_BUFFER_OK;
+
+    off_t offset = buffer->data_offset + (off_t)buffer->end;
+    CSVUringResult result = csv_uring_open(&buffer->uring, buffer->fd, offset, queue_depth, buffer_size);
+    if (result == CSV_URING_ERROR_MEMORY_ALLOCATION) return CSV_BUFFER_ERROR_MEMORY_ALLOCATION;
+    if (result != CSV_URING_OK) return CSV_BUFFER_ERROR_UNSUPPORTED;
+    return CSV_BUFFER_OK;
+}
+
+void csv_buffer_close(CSVBuffer *buffer) {
+    if (!buffer) return;
+
+    csv_readahead_stop(buffer->readahead);
+    csv_uring_close(buffer->uring);
+    if (buffer->fd >= 0) {
+        close(buffer->fd);
+    }
+    if (buffer->source == CSV_BUFFER_SOURCE_MMAP) {
+        if (buffer->data) munmap(buffer->data, buffer->capacity);
+    } else if (buffer->source == CSV_BUFFER_SOURCE_READ) {
+        free(buffer->data);
+    }
+
+    memset(buffer, 0, sizeof(CSVBuffer));
+    buffer->fd = -1;
+}
+
+bool csv_buffer_is_open(const CSVBuffer *buffer) {
+    if (!buffer || !buffer->data) return false;
+    return buffer->source == CSV_BUFFER_SOURCE_MEMORY || buffer->fd >= 0;
+}
+
+static void shift_mark(CSVByteMark *mark, size_t shift) {
+    mark->from = mark->from > shift ? mark->from - shift : 0;
+    mark->to = mark->to > shift ? mark->to - shift : 0;
+}
+
+static CSVBufferResult make_room(CSVBuffer *buffer) {
+    if (buffer->start > 0) {
+        size_t pending = buffer->end - buffer->start;
+        memmove(buffer->data, buffer->data + buffer->start, pending);
+        buffer->data_offset += buffer->start;
+        buffer->scan_pos -= buffer->start;
+        shift_mark(&buffer->quote_mark, buffer->start);
+        shift_mark(&buffer->cr_mark, buffer->start);
+        buffer->end = pending;
+        buffer->start = 0;
+    }
+
+    if (buffer->end < buffer->capacity) return CSV_BUFFER_OK;
+
+    size_t new_capacity = buffer->capacity * 2;
+    char *grown = realloc(buffer->data, new_capacity + 1);
+    if (!grown) return CSV_BUFFER_ERROR_MEMORY_ALLOCATION;
+
+    buffer->data = grown;
+    buffer->capacity = new_capacity;
+    return CSV_BUFFER_OK;
+}
+
+CSVBufferResult csv_buffer_fill(CSVBuffer *buffer) {
+    if (!csv_buffer_is_open(buffer)) return CSV_BUFFER_ERROR_NULL_POINTER;
+    if (buffer->eof) return CSV_BUFFER_OK;
+
+    CSVBufferResult result = make_room(buffer);
+    if (result != CSV_BUFFER_OK) {
+        buffer->error = result;
+        return result;
+    }
+
+    ssize_t n;
+    if (buffer->readahead) {
+        n = csv_readahead_read(buffer->readahead, buffer->data + buffer->end, buffer->capacity - buffer->end);
+    } else if (buffer->uring) {
+        n = csv_uring_read(buffer->uring, buffer->data + buffer->end, buffer->capacity - buffer->end);
+    } else {
+        do {
+            n = read(buffer->fd, buffer->data + buffer->end, buffer->capacity - buffer->end);
+        } while (n < 0 && errno == EINTR);
+    }
+
+    if (n < 0) {
+        buffer->eof = true;
+        buffer->error = CSV_BUFFER_ERROR_FILE_READ;
+        return CSV_BUFFER_ERROR_FILE_READ;
+    }
+
+    if (n == 0) {
+        buffer->eof = true;
+    } else {
+        buffer->end += (size_t)n;
+    }
+
+    return CSV_BUFFER_OK;
+}
+
+CSVBufferResult csv_buffer_seek(CSVBuffer *buffer, off_t offset) {
+    if (!csv_buffer_is_open(buffer)) return CSV_BUFFER_ERROR_NULL_POINTER;
+
+    if (buffer->source != CSV_BUFFER_SOURCE_READ) {
+        if (offset < 0 || offset > (off_t)buffer->end) return CSV_BUFFER_ERROR_FILE_SEEK;
+        buffer->start = (size_t)offset;
+        buffer->scan_pos = buffer->start;
+        buffer->scan_in_quotes = false;
+        return CSV_BUFFER_OK;
+    }
+
+    if (offset >= csv_buffer_tell(buffer) && offset <= buffer->data_offset + (off_t)buffer->end) {
+        buffer->start = (size_t)(offset - buffer->data_offset);
+        buffer->scan_pos = buffer->start;
+        buffer->scan_in_quotes = false;
+        return CSV_BUFFER_OK;
+    }
+
+    if (buffer->readahead) {
+        if (csv_readahead_seek(buffer->readahead, offset) != CSV_READAHEAD_OK) {
+            return CSV_BUFFER_ERROR_FILE_SEEK;
+        }
+    } else if (buffer->uring) {
+        if (csv_uring_seek(buffer->uring, offset) != CSV_URING_OK) {
+            return CSV_BUFFER_ERROR_FILE_SEEK;
+        }
+    } else if (lseek(buffer->fd, offset, SEEK_SET) == (off_t)-1) {
+        return CSV_BUFFER_ERROR_FILE_SEEK;
+    }
+
+    reset_window(buffer, offset);
+    return CSV_BUFFER_OK;
+}
+
+off_t csv_buffer_tell(const CSVBuffer *buffer) {
+    if (!csv_buffer_is_open(buffer)) return -1;
+    return buffer->data_offset + (off_t)buffer->start;
+}
+
+bool csv_buffer_has_data(CSVBuffer *buffer) {
+    if (!csv_buffer_is_open(buffer)) return false;
+
+    while (buffer->start == buffer->end && !buffer->eof) {
+        if (csv_buffer_fill(buffer) != CSV_BUFFER_OK) return false;
+    }
+
+    return buffer->start < buffer->end;
+}
+
+#define CSV_MARK_SPAN (16 * 1024)
+
+/*
+ * Returns the first c in [p, end), or a position at or past end when there
+ * is none. Searches resume from mark when p lies inside it and run up to
+ * CSV_MARK_SPAN bytes ahead, so the bytes of many short records are
+ * searched in one call, each once, while they are still in cache.
+ */
+static size_t find_marked(CSVBuffer *buffer, size_t pos, size_t end, char c, CSVByteMark *mark) {
+    size_t found = pos;
+    if (pos >= mark->from && pos <= mark->to) {
+        found = mark->to;
+    } else {
+        mark->from = pos;
+    }
+    if (found < end && buffer->data[found] != c) {
+        size_t stop = buffer->end - found > CSV_MARK_SPAN ? found + CSV_MARK_SPAN : buffer->end;
+        if (stop < end) stop = end;
+        const char *hit = memchr(buffer->data + found, c, stop - found);
+        found = hit ? (size_t)(hit - buffer->data) : stop;
+    }
+    mark->to = found;
+    return found;
+}
+
+/*
+ * Scans forward from scan_pos looking for a record terminator outside of
+ * quotes. Only enclosure, '\r' and '\n' are ever inspected individually;
+ * everything between them is skipped with memchr. Returns true and the
+ * terminator offset when one is found, otherwise records where to resume.
+ * While *unquoted is set the enclosure and '\r' come from find_marked, and
+ * reaching an enclosure clears it and resumes quote tracking there.
+ */
+static bool scan_for_terminator(CSVBuffer *buffer, char enclosure, bool *unquoted, size_t *terminator) {
+    const char *data = buffer->data;
+    const char *p = data + buffer->scan_pos;
+    const char *limit = data + buffer->end;
+    bool in_quotes = buffer->scan_in_quotes;
+
+    if (unquoted && *unquoted && !in_quotes && p < limit) {
+        const char *nl = memchr(p, '\n', limit - p);
+        const char *span_end = nl ? nl : limit;
+        size_t pos = p - data;
+        size_t end = span_end - data;
+        const char *q = data + find_marked(buffer, pos, end, enclosure, &buffer->quote_mark);
+        const char *cr = data + find_marked(buffer, pos, end, '\r', &buffer->cr_mark);
+
+        if (q < span_end && q <= cr) {
+            *unquoted = false;
+        } else if (cr < span_end) {
+            if (cr + 1 == limit && !buffer->eof) {
+                buffer->scan_pos = cr - data;
+                return false;
+            }
+            *terminator = cr - data;
+            return true;
+        } else if (nl) {
+            *terminator = nl - data;
+            return true;
+        } else {
+            p = limit;
+        }
+    }
+
+    while (p < limit) {
+        if (in_quotes) {
+            const char *q = memchr(p, enclosure, limit - p);
+            if (!q) {
+                p = limit;
+                break;
+            }
+            if (q + 1 == limit && !buffer->eof) {
+                p = q;
+                break;
+            }
+            if (q + 1 < limit && q[1] == enclosure) {
+                p = q + 2;
+                continue;
+            }
+            in_quotes = false;
+            p = q + 1;
+            continue;
+        }
+
+        const char *nl = memchr(p, '\n', limit - p);
+        const char *span_end = nl ? nl : limit;
+        const char *q = memchr(p, enclosure, span_end - p);
+        const char *cr = memchr(p, '\r', (q ? q : span_end) - p);
+
+        if (cr) {
+            if (cr + 1 == limit && !buffer->eof) {
+                p = cr;
+                break;
+            }
+            *terminator = cr - data;
+            return true;
+        }
+        if (q) {
+            in_quotes = true;
+            p = q + 1;
+            continue;
+        }
+        if (nl) {
+            *terminator = nl - data;
+            return true;
+        }
+        p = limit;
+    }
+
+    buffer->scan_pos = p - data;
+    buffer->scan_in_quotes = in_quotes;
+    return false;
+}
+
+const char* csv_buffer_peek(CSVBuffer *buffer, size_t *available, bool *at_end) {
+    if (!csv_buffer_has_data(buffer)) return NULL;
+
+    if (available) *available = buffer->end - buffer->start;
+    if (at_end) *at_end = buffer->eof;
+    return buffer->data + buffer->start;
+}
+
+void csv_buffer_consume(CSVBuffer *buffer, size_t length) {
+    if (!csv_buffer_is_open(buffer)) return;
+
+    if (length > buffer->end - buffer->start) length = buffer->end - buffer->start;
+    buffer->start += length;
+    buffer->scan_pos = buffer->start;
+    buffer->scan_in_quotes = false;
+}
+
+const char* csv_buffer_next_record(CSVBuffer *buffer, char enclosure, size_t *length) {
+    return csv_buffer_next_record_unquoted(buffer, enclosure, NULL, length);
+}
+
+const char* csv_buffer_next_record_unquoted(CSVBuffer *buffer, char enclosure, bool *unquoted, size_t *length) {
+    if (!csv_buffer_is_open(buffer)) return NULL;
+
+    for (;;) {
+        size_t terminator;
+        if (scan_for_terminator(buffer, enclosure, unquoted, &terminator)) {
+            char *record = buffer->data + buffer->start;
+            size_t next = terminator + 1;
+            if (buffer->data[terminator] == '\r' && next < buffer->end && buffer->data[next] == '\n') {
+                next++;
+            }
+
+            if (buffer->source == CSV_BUFFER_SOURCE_READ) buffer->data[terminator] = '\0';
+            if (length) *length = terminator - buffer->start;
+
+            buffer->start = next;
+            buffer->scan_pos = next;
+            buffer->scan_in_quotes = false;
+            return record;
+        }
+
+        if (buffer->eof) {
+            if (buffer->start == buffer->end) return NULL;
+
+            char *record = buffer->data + buffer->start;
+            if (buffer->source == CSV_BUFFER_SOURCE_READ) buffer->data[buffer->end] = '\0';
+            if (length) *length = buffer->end - buffer->start;
+
+            buffer->start = buffer->end;
+            buffer->scan_pos = buffer->end;
+            buffer->scan_in_quotes = false;
+            return record;
+        }
+
+        if (csv_buffer_fill(buffer) != CSV_BUFFER_OK) return NULL;
+    }
+}
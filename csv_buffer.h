@@ -0,0 +1,93 @@
+#ifndef CSV_BUFFER_H
+#define CSV_BUFFER_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <sys/types.h>
+#include "csv_readahead.h"
+#include "csv_uring.h"
+
+#define CSV_BUFFER_DEFAULT_SIZE (128 * 1024)
+
+typedef enum {
+    CSV_BUFFER_OK = 0,
+    CSV_BUFFER_ERROR_NULL_POINTER,
+    CSV_BUFFER_ERROR_MEMORY_ALLOCATION,
+    CSV_BUFFER_ERROR_FILE_OPEN,
+    CSV_BUFFER_ERROR_FILE_READ,
+    CSV_BUFFER_ERROR_FILE_SEEK,
+    CSV_BUFFER_ERROR_UNSUPPORTED
+} CSVBufferResult;
+
+typedef enum {
+    CSV_BUFFER_SOURCE_READ,
+    CSV_BUFFER_SOURCE_MMAP,
+    CSV_BUFFER_SOURCE_MEMORY
+} CSVBufferSource;
+
+/*
+ * Unquoted framing: window bytes [from, to) hold no copy of the byte
+ * searched for, and to is either that byte or where the search stopped.
+ */
+typedef struct {
+    size_t from;
+    size_t to;
+} CSVByteMark;
+
+typedef struct {
+    int fd;
+    char *data;
+    size_t capacity;
+    size_t start;
+    size_t end;
+    size_t scan_pos;
+    bool scan_in_quotes;
+    CSVByteMark quote_mark;
+    CSVByteMark cr_mark;
+    off_t data_offset;
+    bool eof;
+    CSVBufferSource source;
+    CSVBufferResult error;
+    CSVReadAhead *readahead;
+    CSVUring *uring;
+} CSVBuffer;
+
+CSVBufferResult csv_buffer_open(CSVBuffer *buffer, const char *path, size_t capacity);
+CSVBufferResult csv_buffer_open_mapped(CSVBuffer *buffer, const char *path);
+CSVBufferResult csv_buffer_open_memory(CSVBuffer *buffer, const char *data, size_t length);
+void csv_buffer_close(CSVBuffer *buffer);
+
+/* Streamed buffers only: later fills are served by a read-ahead thread. */
+CSVBufferResult csv_buffer_start_readahead(CSVBuffer *buffer, int buffer_count, size_t buffer_size);
+/* Streamed regular files only: later fills are served by io_uring reads kept in flight. */
+CSVBufferResult csv_buffer_start_uring(CSVBuffer *buffer, int queue_depth, size_t buffer_size);
+bool csv_buffer_is_open(const CSVBuffer *buffer);
+
+CSVBufferResult csv_buffer_fill(CSVBuffer *buffer);
+CSVBufferResult csv_buffer_seek(CSVBuffer *buffer, off_t offset);
+off_t csv_buffer_tell(const CSVBuffer *buffer);
+bool csv_buffer_has_data(CSVBuffer *buffer);
+
+/* Streamed records are NUL-terminated in place; mapped and memory records are not. */
+const char* csv_buffer_next_record(CSVBuffer *buffer, char enclosure, size_t *length);
+
+/*
+ * Same records as csv_buffer_next_record. While *unquoted is set, quotes
+ * are not tracked: records end at the next newline, and the enclosure and
+ * '\r' are searched for across many records at a time rather than within
+ * each one. The first enclosure clears *unquoted, and framing tracks quotes
+ * from that record on.
+ */
+const char* csv_buffer_next_record_unquoted(CSVBuffer *buffer, char enclosure, bool *unquoted, size_t *length);
+
+/*
+ * For callers that frame records themselves: the unconsumed bytes, filling
+ * first if there are none, or NULL at end of input. at_end is set once no
+ * more data will follow. consume advances past bytes the caller has used.
+ */
+const char* csv_buffer_peek(CSVBuffer *buffer, size_t *available, bool *at_end);
+void csv_buffer_consume(CSVBuffer *buffer, size_t length);
+
+const char* csv_buffer_error_string(CSVBufferResult result);
+
+#endif
@@ -19,6 +19,17 @@ CSVConfig* csv_config_create(Arena *arena) {
     config->trimFields = false;
     config->preserveQuotes = false;
     config->autoFlush = true;
+    config->readerBackend = CSV_READER_BACKEND_STREAM;
+    config->indexStride = 0;
+    config->persistIndex = false;
+    config->flushRecords = 0;
+    config->flushBytes = 0;
+    config->flushIntervalMs = 0;
+    config->syncOnFlush = false;
+    config->asyncWrite = false;
+    config->readAheadBuffers = 0;
+    config->readAheadBufferSize = 0;
+    config->quoting = CSV_QUOTING_DETECT;
     
     return config;
 }
@@ -97,6 +108,50 @@ bool csv_config_get_auto_flush(const CSVConfig *config) {
     return config ? config->autoFlush : true;
 }
 
+CSVReaderBackend csv_config_get_reader_backend(const CSVConfig *config) {
+    return config ? config->readerBackend : CSV_READER_BACKEND_STREAM;
+}
+
+int csv_config_get_index_stride(const CSVConfig *config) {
+    return config ? config->indexStride : 0;
+}
+
+bool csv_config_get_persist_index(const CSVConfig *config) {
+    return config ? config->persistIndex : false;
+}
+
+int csv_config_get_flush_records(const CSVConfig *config) {
+    return config ? config->flushRecords : 0;
+}
+
+size_t csv_config_get_flush_bytes(const CSVConfig *config) {
+    return config ? config->flushBytes : 0;
+}
+
+int csv_config_get_flush_interval_ms(const CSVConfig *config) {
+    return config ? config->flushIntervalMs : 0;
+}
+
+bool csv_config_get_sync_on_flush(const CSVConfig *config) {
+    return config ? config->syncOnFlush : false;
+}
+
+bool csv_config_get_async_write(const CSVConfig *config) {
+    return config ? config->asyncWrite : false;
+}
+
+int csv_config_get_read_ahead_buffers(const CSVConfig *config) {
+    return config ? config->readAheadBuffers : 0;
+}
+
+size_t csv_config_get_read_ahead_buffer_size(const CSVConfig *config) {
+    return config ? config->readAheadBufferSize : 0;
+}
+
+CSVQuoting csv_config_get_quoting(const CSVConfig *config) {
+    return config ? config->quoting : CSV_QUOTING_DETECT;
+}
+
 void csv_config_set_delimiter(CSVConfig *config, char delimiter) {
     if (config) config->delimiter = delimiter;
 }
@@ -154,4 +209,48 @@ void csv_config_set_preserve_quotes(CSVConfig *config, bool preserveQuotes) {
 
 void csv_config_set_auto_flush(CSVConfig *config, bool autoFlush) {
     if (config) config->autoFlush = autoFlush;
+}
+
+void csv_config_set_reader_backend(CSVConfig *config, CSVReaderBackend readerBackend) {
+    if (config) config->readerBackend = readerBackend;
+}
+
+void csv_config_set_index_stride(CSVConfig *config, int indexStride) {
+    if (config) config->indexStride = indexStride > 0 ? indexStride : 0;
+}
+
+void csv_config_set_persist_index(CSVConfig *config, bool persistIndex) {
+    if (config) config->persistIndex = persistIndex;
+}
+
+void csv_config_set_flush_records(CSVConfig *config, int flushRecords) {
+    if (config) config->flushRecords = flushRecords > 0 ? flushRecords : 0;
+}
+
+void csv_config_set_flush_bytes(CSVConfig *config, size_t flushBytes) {
+    if (config) config->flushBytes = flushBytes;
+}
+
+void csv_config_set_flush_interval_ms(CSVConfig *config, int flushIntervalMs) {
+    if (config) config->flushIntervalMs = flushIntervalMs > 0 ? flushIntervalMs : 0;
+}
+
+void csv_config_set_sync_on_flush(CSVConfig *config, bool syncOnFlush) {
+    if (config) config->syncOnFlush = syncOnFlush;
+}
+
+void csv_config_set_async_write(CSVConfig *config, bool asyncWrite) {
+    if (config) config->asyncWrite = asyncWrite;
+}
+
+void csv_config_set_read_ahead_buffers(CSVConfig *config, int readAheadBuffers) {
+    if (config) config->readAheadBuffers = readAheadBuffers > 0 ? readAheadBuffers : 0;
+}
+
+void csv_config_set_read_ahead_buffer_size(CSVConfig *config, size_t readAheadBufferSize) {
+    if (config) config->readAheadBufferSize = readAheadBufferSize;
+}
+
+void csv_config_set_quoting(CSVConfig *config, CSVQuoting quoting) {
+    if (config) config->quoting = quoting;
 } 
@@ -22,6 +22,24 @@ typedef enum {
     CSV_ENCODING_LATIN1
 } CSVEncoding;
 
+typedef enum {
+    CSV_READER_BACKEND_STREAM,
+    CSV_READER_BACKEND_MMAP,
+    CSV_READER_BACKEND_IO_URING
+} CSVReaderBackend;
+
+/*
+ * Whether readers track quotes. DETECT skips quote tracking when the first
+ * buffered bytes hold no enclosure, NONE skips it from the start, and FULL
+ * always tracks. Either way the first enclosure seen switches the rest of
+ * the input back to full quote handling.
+ */
+typedef enum {
+    CSV_QUOTING_DETECT,
+    CSV_QUOTING_NONE,
+    CSV_QUOTING_FULL
+} CSVQuoting;
+
 typedef struct {
     char delimiter;
     char enclosure;
@@ -37,6 +55,17 @@ typedef struct {
     bool trimFields;
     bool preserveQuotes;
     bool autoFlush;
+    CSVReaderBackend readerBackend;
+    int indexStride;
+    bool persistIndex;
+    int flushRecords;
+    size_t flushBytes;
+    int flushIntervalMs;
+    bool syncOnFlush;
+    bool asyncWrite;
+    int readAheadBuffers;
+    size_t readAheadBufferSize;
+    CSVQuoting quoting;
 } CSVConfig;
 
 CSVConfig* csv_config_create(Arena *arena);
@@ -57,6 +86,17 @@ bool csv_config_get_skip_empty_lines(const CSVConfig *config);
 bool csv_config_get_trim_fields(const CSVConfig *config);
 bool csv_config_get_preserve_quotes(const CSVConfig *config);
 bool csv_config_get_auto_flush(const CSVConfig *config);
+CSVReaderBackend csv_config_get_reader_backend(const CSVConfig *config);
+int csv_config_get_index_stride(const CSVConfig *config);
+bool csv_config_get_persist_index(const CSVConfig *config);
+int csv_config_get_flush_records(const CSVConfig *config);
+size_t csv_config_get_flush_bytes(const CSVConfig *config);
+int csv_config_get_flush_interval_ms(const CSVConfig *config);
+bool csv_config_get_sync_on_flush(const CSVConfig *config);
+bool csv_config_get_async_write(const CSVConfig *config);
+int csv_config_get_read_ahead_buffers(const CSVConfig *config);
+size_t csv_config_get_read_ahead_buffer_size(const CSVConfig *config);
+CSVQuoting csv_config_get_quoting(const CSVConfig *config);
 
 void csv_config_set_delimiter(CSVConfig *config, char delimiter);
 void csv_config_set_enclosure(CSVConfig *config, char enclosure);
@@ -72,5 +112,21 @@ void csv_config_set_skip_empty_lines(CSVConfig *config, bool skipEmptyLines);
 void csv_config_set_trim_fields(CSVConfig *config, bool trimFields);
 void csv_config_set_preserve_quotes(CSVConfig *config, bool preserveQuotes);
 void csv_config_set_auto_flush(CSVConfig *config, bool autoFlush);
+void csv_config_set_reader_backend(CSVConfig *config, CSVReaderBackend readerBackend);
+void csv_config_set_index_stride(CSVConfig *config, int indexStride);
+void csv_config_set_persist_index(CSVConfig *config, bool persistIndex);
+/*
+ * Writer flush thresholds, applied while autoFlush is on. flushIntervalMs
+ * has no timer: it is checked on each write and by csv_writer_poll. A
+ * flushBytes above CSV_WRITER_BUFFER_SIZE enlarges the writer's buffer.
+ */
+void csv_config_set_flush_records(CSVConfig *config, int flushRecords);
+void csv_config_set_flush_bytes(CSVConfig *config, size_t flushBytes);
+void csv_config_set_flush_interval_ms(CSVConfig *config, int flushIntervalMs);
+void csv_config_set_sync_on_flush(CSVConfig *config, bool syncOnFlush);
+void csv_config_set_async_write(CSVConfig *config, bool asyncWrite);
+void csv_config_set_read_ahead_buffers(CSVConfig *config, int readAheadBuffers);
+void csv_config_set_read_ahead_buffer_size(CSVConfig *config, size_t readAheadBufferSize);
+void csv_config_set_quoting(CSVConfig *config, CSVQuoting quoting);
 
 #endif 
@@ -0,0 +1,31 @@
+#ifndef CSV_COUNT_H
+#define CSV_COUNT_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <sys/types.h>
+
+typedef struct {
+    char enclosure;
+    bool skip_empty_lines;
+    long skip_records;
+    bool in_quotes;
+    bool pending_cr;
+    bool record_open;
+    bool record_blank;
+    long count;
+} CSVRecordCounter;
+
+/*
+ * Counts records with the same boundaries as csv_buffer_next_record
+ * without materializing them. Input may be fed in pieces of any size;
+ * the first skip_records records are dropped before counting.
+ */
+void csv_count_init(CSVRecordCounter *counter, char enclosure, bool skip_empty_lines, long skip_records);
+void csv_count_feed(CSVRecordCounter *counter, const char *data, size_t length);
+long csv_count_finish(CSVRecordCounter *counter);
+
+long csv_count_records(const char *data, size_t length, char enclosure, bool skip_empty_lines, long skip_records);
+long csv_count_fd(int fd, char enclosure, bool skip_empty_lines, long skip_records);
+
+#endif
@@ -0,0 +1,256 @@
+#include "csv_filter.h"
+#include <stdlib.h>
+#include <string.h>
+
+static CSVPredicate* new_predicate(Arena *arena, CSVPredicateType type, int column) {
+    if (!arena || column < 0) {
+        return NULL;
+    }
+
+    void *ptr;
+    if (arena_alloc(arena, sizeof(CSVPredicate), &ptr) != ARENA_OK) {
+        return NULL;
+    }
+
+    CSVPredicate *predicate = (CSVPredicate*)ptr;
+    memset(predicate, 0, sizeof(CSVPredicate));
+    predicate->type = type;
+    predicate->column = column;
+    predicate->max_column = column;
+    return predicate;
+}
+
+static CSVPredicate* new_text_predicate(Arena *arena, CSVPredicateType type, int column, const char *value) {
+    if (!value) {
+        return NULL;
+    }
+
+    CSVPredicate *predicate = new_predicate(arena, type, column);
+    if (!predicate) {
+        return NULL;
+    }
+
+    char *copy = arena_strdup(arena, value);
+    if (!copy) {
+        return NULL;
+    }
+    predicate->value = copy;
+    predicate->value_length = strlen(copy);
+    return predicate;
+}
+
+static CSVPredicate* new_combined_predicate(Arena *arena, CSVPredicateType type,
+                                            const CSVPredicate *left, const CSVPredicate *right) {
+    if (!left || !right) {
+        return NULL;
+    }
+
+    CSVPredicate *predicate = new_predicate(arena, type, 0);
+    if (!predicate) {
+        return NULL;
+    }
+    predicate->left = left;
+    predicate->right = right;
+    predicate->max_column = left->max_column > right->max_column ? left->max_column : right->max_column;
+    return predicate;
+}
+
+CSVPredicate* csv_predicate_equals(Arena *arena, int column, const char *value) {
+    return new_text_predicate(arena, CSV_PREDICATE_EQUALS, column, value);
+}
+
+CSVPredicate* csv_predicate_prefix(Arena *arena, int column, const char *prefix) {
+    return new_text_predicate(arena, CSV_PREDICATE_PREFIX, column, prefix);
+}
+
+CSVPredicate* csv_predicate_contains(Arena *arena, int column, const char *needle) {
+    return new_text_predicate(arena, CSV_PREDICATE_CONTAINS, column, needle);
+}
+
+CSVPredicate* csv_predicate_range(Arena *arena, int column, double min, double max) {
+    CSVPredicate *predicate = new_predicate(arena, CSV_PREDICATE_RANGE, column);
+    if (predicate) {
+        predicate->min = min;
+        predicate->max = max;
+    }
+    return predicate;
+}
+
+CSVPredicate* csv_predicate_and(Arena *arena, const CSVPredicate *left, const CSVPredicate *right) {
+    return new_combined_predicate(arena, CSV_PREDICATE_AND, left, right);
+}
+
+CSVPredicate* csv_predicate_or(Arena *arena, const CSVPredicate *left, const CSVPredicate *right) {
+    return new_combined_predicate(arena, CSV_PREDICATE_OR, left, right);
+}
+
+int csv_predicate_max_column(const CSVPredicate *predicate) {
+    return predicate ? predicate->max_column : -1;
+}
+
+static bool contains_text(const char *haystack, size_t length, const char *needle, size_t needle_length) {
+    if (needle_length == 0) {
+        return true;
+    }
+
+    const char *p = haystack;
+    const char *last = haystack + length;
+    while ((size_t)(last - p) >= needle_length) {
+        const char *q = memchr(p, needle[0], (size_t)(last - p) - needle_length + 1);
+        if (!q) {
+            return false;
+        }
+        if (memcmp(q, needle, needle_length) == 0) {
+            return true;
+        }
+        p = q + 1;
+    }
+    return false;
+}
+
+static bool in_range(const char *text, size_t length, double min, double max) {
+    char number[64];
+    if (length == 0 || length >= sizeof(number)) {
+        return false;
+    }
+    memcpy(number, text, length);
+    number[length] = '\0';
+
+    char *end;
+    double value = strtod(number, &end);
+    if (end == number) {
+        return false;
+    }
+    while (*end == ' ' || *end == '\t') {
+        end++;
+    }
+    return *end == '\0' && value >= min && value <= max;
+}
+
+typedef struct {
+    const char *line;
+    size_t length;
+    const CSVConfig *config;
+    Arena *scratch;
+    CSVProjection projection;
+    const CSVFieldView *fields;
+    size_t field_count;
+    bool lazy;
+    bool malformed;
+} LineFields;
+
+/*
+ * Lazy lines are split only as far as the column a leaf asks for, so an
+ * AND whose first leaf fails never looks past that leaf's column. Asking
+ * for a later column splits the line again from the start, which costs at
+ * most the prefix already seen.
+ */
+static const CSVFieldView* field_at(LineFields *line, int column) {
+    if (line->lazy && (size_t)column >= line->field_count && !line->malformed) {
+        line->projection.column_count = (size_t)column + 1;
+        line->projection.output_count = (size_t)column + 1;
+        CSVParseViewResult result = csv_parse_line_views_projected(line->line, line->length, line->scratch,
+                                                                   line->config, 0, &line->projection);
+        if (!result.success) {
+            line->malformed = true;
+            return NULL;
+        }
+        line->fields = result.fields.fields;
+        line->field_count = result.fields.count;
+    }
+    return (size_t)column < line->field_count ? &line->fields[column] : NULL;
+}
+
+static bool field_matches(const CSVPredicate *predicate, LineFields *line) {
+    const char *text = "";
+    size_t length = 0;
+
+    const CSVFieldView *field = field_at(line, predicate->column);
+    if (line->malformed) {
+        return true;
+    }
+    if (field) {
+        text = field->data;
+        length = field->length;
+        if (field->needs_unescape) {
+            char *unescaped = csv_field_view_to_string(field, line->config->enclosure, line->scratch);
+            if (!unescaped) {
+                return false;
+            }
+            text = unescaped;
+            length = strlen(unescaped);
+        }
+    }
+
+    switch (predicate->type) {
+        case CSV_PREDICATE_EQUALS:
+            return length == predicate->value_length && memcmp(text, predicate->value, length) == 0;
+        case CSV_PREDICATE_PREFIX:
+            return length >= predicate->value_length && memcmp(text, predicate->value, predicate->value_length) == 0;
+        case CSV_PREDICATE_CONTAINS:
+            return contains_text(text, length, predicate->value, predicate->value_length);
+        case CSV_PREDICATE_RANGE:
+            return in_range(text, length, predicate->min, predicate->max);
+        default:
+            return false;
+    }
+}
+
+static bool evaluate(const CSVPredicate *predicate, LineFields *line) {
+    switch (predicate->type) {
+        case CSV_PREDICATE_AND:
+            return evaluate(predicate->left, line) && evaluate(predicate->right, line);
+        case CSV_PREDICATE_OR:
+            return evaluate(predicate->left, line) || evaluate(predicate->right, line);
+        default:
+            return field_matches(predicate, line);
+    }
+}
+
+bool csv_predicate_matches(const CSVPredicate *predicate, const CSVFieldView *fields, size_t field_count,
+                           const CSVConfig *config, Arena *scratch) {
+    if (!predicate) {
+        return true;
+    }
+    if (!config || (field_count > 0 && !fields)) {
+        return false;
+    }
+
+    LineFields line;
+    memset(&line, 0, sizeof(LineFields));
+    line.config = config;
+    line.scratch = scratch;
+    line.fields = fields;
+    line.field_count = field_count;
+    return evaluate(predicate, &line);
+}
+
+bool csv_predicate_matches_line(const CSVPredicate *predicate, const char *text, size_t length,
+                                const CSVConfig *config, Arena *scratch) {
+    if (!predicate) {
+        return true;
+    }
+    if (!text || !config || !scratch) {
+        return false;
+    }
+
+    void *ptr;
+    size_t column_count = (size_t)predicate->max_column + 1;
+    if (arena_alloc(scratch, column_count * sizeof(int), &ptr) != ARENA_OK) {
+        return true;
+    }
+    int *slots = (int*)ptr;
+    for (size_t i = 0; i < column_count; i++) {
+        slots[i] = (int)i;
+    }
+
+    LineFields line;
+    memset(&line, 0, sizeof(LineFields));
+    line.line = text;
+    line.length = length;
+    line.config = config;
+    line.scratch = scratch;
+    line.projection.slots = slots;
+    line.lazy = true;
+    return evaluate(predicate, &line);
+}
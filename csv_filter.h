@@ -0,0 +1,63 @@
+#ifndef CSV_FILTER_H
+#define CSV_FILTER_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "csv_parser.h"
+#include "arena.h"
+
+typedef enum {
+    CSV_PREDICATE_EQUALS,
+    CSV_PREDICATE_PREFIX,
+    CSV_PREDICATE_CONTAINS,
+    CSV_PREDICATE_RANGE,
+    CSV_PREDICATE_AND,
+    CSV_PREDICATE_OR
+} CSVPredicateType;
+
+typedef struct CSVPredicate {
+    CSVPredicateType type;
+    int column;
+    const char *value;
+    size_t value_length;
+    double min;
+    double max;
+    const struct CSVPredicate *left;
+    const struct CSVPredicate *right;
+    int max_column;
+} CSVPredicate;
+
+/*
+ * Predicates are allocated from arena and must outlive any reader they are
+ * installed on. Builders return NULL on allocation failure, a negative
+ * column or a NULL child, so a chain of calls only needs one check.
+ * Fields are compared after unescaping; columns missing from a short row
+ * compare as the empty string. Ranges are inclusive and only match fields
+ * that parse completely as numbers.
+ */
+CSVPredicate* csv_predicate_equals(Arena *arena, int column, const char *value);
+CSVPredicate* csv_predicate_prefix(Arena *arena, int column, const char *prefix);
+CSVPredicate* csv_predicate_contains(Arena *arena, int column, const char *needle);
+CSVPredicate* csv_predicate_range(Arena *arena, int column, double min, double max);
+CSVPredicate* csv_predicate_and(Arena *arena, const CSVPredicate *left, const CSVPredicate *right);
+CSVPredicate* csv_predicate_or(Arena *arena, const CSVPredicate *left, const CSVPredicate *right);
+
+/* Highest column the predicate reads; fields after it never need parsing. */
+int csv_predicate_max_column(const CSVPredicate *predicate);
+
+/*
+ * Evaluates against fields that are already split. Unescaped copies of
+ * quoted fields, when needed, go to scratch.
+ */
+bool csv_predicate_matches(const CSVPredicate *predicate, const CSVFieldView *fields, size_t field_count,
+                           const CSVConfig *config, Arena *scratch);
+
+/*
+ * Evaluates against a raw record, splitting it only as far as the leaves
+ * being evaluated need. A record that fails to split matches, so the
+ * caller's own parse reports the error.
+ */
+bool csv_predicate_matches_line(const CSVPredicate *predicate, const char *line, size_t length,
+                                const CSVConfig *config, Arena *scratch);
+
+#endif
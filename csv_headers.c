@@ -0,0 +1,87 @@
+#include "csv_headers.h"
+#include <string.h>
+
+static uint32_t hash_name(const char *name, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)name[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+void csv_header_map_init(CSVHeaderMap *map) {
+    if (map) {
+        memset(map, 0, sizeof(CSVHeaderMap));
+    }
+}
+
+bool csv_header_map_build(CSVHeaderMap *map, char **names, int count, Arena *arena) {
+    if (!map || !arena || count < 0 || (count > 0 && !names)) {
+        return false;
+    }
+    csv_header_map_init(map);
+    if (count == 0) {
+        return true;
+    }
+
+    /* At most half full, so probes stay short and a free slot always ends them. */
+    size_t capacity = 8;
+    while (capacity < (size_t)count * 2) {
+        capacity *= 2;
+    }
+
+    void *slots_ptr;
+    void *hashes_ptr;
+    if (arena_alloc(arena, capacity * sizeof(int), &slots_ptr) != ARENA_OK ||
+        arena_alloc(arena, capacity * sizeof(uint32_t), &hashes_ptr) != ARENA_OK) {
+        return false;
+    }
+    memset(slots_ptr, 0, capacity * sizeof(int));
+
+    map->names = names;
+    map->slots = (int*)slots_ptr;
+    map->hashes = (uint32_t*)hashes_ptr;
+    map->mask = capacity - 1;
+    map->count = count;
+
+    for (int column = 0; column < count; column++) {
+        const char *name = names[column] ? names[column] : "";
+        size_t length = strlen(name);
+        if (csv_header_map_find_length(map, name, length) >= 0) {
+            continue;
+        }
+
+        uint32_t hash = hash_name(name, length);
+        size_t slot = hash & map->mask;
+        while (map->slots[slot] != 0) {
+            slot = (slot + 1) & map->mask;
+        }
+        map->slots[slot] = column + 1;
+        map->hashes[slot] = hash;
+    }
+    return true;
+}
+
+int csv_header_map_find_length(const CSVHeaderMap *map, const char *name, size_t length) {
+    if (!map || !map->slots || !name) {
+        return -1;
+    }
+
+    uint32_t hash = hash_name(name, length);
+    for (size_t slot = hash & map->mask; map->slots[slot] != 0; slot = (slot + 1) & map->mask) {
+        if (map->hashes[slot] != hash) {
+            continue;
+        }
+        int column = map->slots[slot] - 1;
+        const char *candidate = map->names[column] ? map->names[column] : "";
+        if (strncmp(candidate, name, length) == 0 && candidate[length] == '\0') {
+            return column;
+        }
+    }
+    return -1;
+}
+
+int csv_header_map_find(const CSVHeaderMap *map, const char *name) {
+    return name ? csv_header_map_find_length(map, name, strlen(name)) : -1;
+}
@@ -0,0 +1,29 @@
+#ifndef CSV_HEADERS_H
+#define CSV_HEADERS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "arena.h"
+
+/*
+ * Open-addressing map from header name to column index. Names are not
+ * copied, so the array passed to csv_header_map_build must outlive the map.
+ * When a name repeats, the first column wins.
+ */
+typedef struct {
+    char **names;
+    int *slots;
+    uint32_t *hashes;
+    size_t mask;
+    int count;
+} CSVHeaderMap;
+
+void csv_header_map_init(CSVHeaderMap *map);
+bool csv_header_map_build(CSVHeaderMap *map, char **names, int count, Arena *arena);
+
+/* Column index of name, or -1. */
+int csv_header_map_find(const CSVHeaderMap *map, const char *name);
+int csv_header_map_find_length(const CSVHeaderMap *map, const char *name, size_t length);
+
+#endif
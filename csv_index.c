@@ -0,0 +1,231 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "csv_index.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#define INDEX_FILE_MAGIC "CSVIDX01"
+
+typedef struct {
+    char magic[8];
+    int64_t source_size;
+    int64_t source_mtime_sec;
+    int64_t source_mtime_nsec;
+    int64_t record_count;
+    uint64_t stride;
+    uint64_t count;
+    int32_t enclosure;
+    int32_t reserved;
+} IndexFileHeader;
+
+const char* csv_index_error_string(CSVIndexResult result) {
+    switch (result) {
+        case CSV_INDEX_OK: return "Success";
+        case CSV_INDEX_ERROR_NULL_POINTER: return "Null pointer error";
+        case CSV_INDEX_ERROR_MEMORY_ALLOCATION: return "Memory allocation failed";
+        case CSV_INDEX_ERROR_FILE_OPEN: return "Failed to open index file";
+        case CSV_INDEX_ERROR_FILE_READ: return "Failed to read index";
+        case CSV_INDEX_ERROR_FILE_WRITE: return "Failed to write index file";
+        case CSV_INDEX_ERROR_INVALID_FORMAT: return "Invalid index file format";
+        case CSV_INDEX_ERROR_STALE: return "Index does not match the source file";
+        default: return "Unknown error";
+    }
+}
+
+void csv_index_init(CSVRecordIndex *index) {
+    if (index) memset(index, 0, sizeof(CSVRecordIndex));
+}
+
+void csv_index_free(CSVRecordIndex *index) {
+    if (!index) return;
+
+    free(index->offsets);
+    memset(index, 0, sizeof(CSVRecordIndex));
+}
+
+bool csv_index_is_built(const CSVRecordIndex *index) {
+    return index && index->count > 0;
+}
+
+/* Darwin has no st_mtim; under _POSIX_C_SOURCE it splits the time into st_mtime and st_mtimensec. */
+static void stat_mtime(const struct stat *st, int64_t *sec, int64_t *nsec) {
+#ifdef __APPLE__
+    *sec = (int64_t)st->st_mtime;
+    *nsec = (int64_t)st->st_mtimensec;
+#else
+    *sec = (int64_t)st->st_mtim.tv_sec;
+    *nsec = (int64_t)st->st_mtim.tv_nsec;
+#endif
+}
+
+static bool source_stamp(const CSVBuffer *source, int64_t *size, int64_t *mtime_sec, int64_t *mtime_nsec) {
+    struct stat st;
+    if (!source || source->fd < 0 || fstat(source->fd, &st) != 0) {
+        return false;
+    }
+
+    *size = (int64_t)st.st_size;
+    stat_mtime(&st, mtime_sec, mtime_nsec);
+    return true;
+}
+
+static bool append_offset(CSVRecordIndex *index, off_t offset) {
+    if (index->count == index->capacity) {
+        size_t capacity = index->capacity ? index->capacity * 2 : 64;
+        off_t *offsets = realloc(index->offsets, capacity * sizeof(off_t));
+        if (!offsets) return false;
+        index->offsets = offsets;
+        index->capacity = capacity;
+    }
+
+    index->offsets[index->count++] = offset;
+    return true;
+}
+
+/*
+ * Scans every record from the buffer's current position, which must be
+ * the first data record, and keeps the offset of every stride-th one. The
+ * buffer is left at end of input; callers restore their own position.
+ */
+CSVIndexResult csv_index_build(CSVRecordIndex *index, CSVBuffer *input, char enclosure, size_t stride) {
+    if (!index || !csv_buffer_is_open(input)) return CSV_INDEX_ERROR_NULL_POINTER;
+
+    csv_index_free(index);
+    index->stride = stride ? stride : CSV_INDEX_DEFAULT_STRIDE;
+    index->enclosure = enclosure;
+    source_stamp(input, &index->source_size, &index->source_mtime_sec, &index->source_mtime_nsec);
+
+    if (!append_offset(index, csv_buffer_tell(input))) {
+        csv_index_free(index);
+        return CSV_INDEX_ERROR_MEMORY_ALLOCATION;
+    }
+
+    long record = 0;
+    for (;;) {
+        off_t offset = csv_buffer_tell(input);
+        if (!csv_buffer_next_record(input, enclosure, NULL)) break;
+
+        if (record > 0 && (size_t)record % index->stride == 0 && !append_offset(index, offset)) {
+            csv_index_free(index);
+            return CSV_INDEX_ERROR_MEMORY_ALLOCATION;
+        }
+        record++;
+    }
+
+    if (input->error != CSV_BUFFER_OK) {
+        csv_index_free(index);
+        return CSV_INDEX_ERROR_FILE_READ;
+    }
+
+    index->record_count = record;
+    return CSV_INDEX_OK;
+}
+
+bool csv_index_lookup(const CSVRecordIndex *index, long record, off_t *offset, long *remaining) {
+    if (!csv_index_is_built(index) || record < 0 || !offset || !remaining) return false;
+
+    size_t slot = (size_t)record / index->stride;
+    if (slot >= index->count) slot = index->count - 1;
+
+    *offset = index->offsets[slot];
+    *remaining = record - (long)(slot * index->stride);
+    return true;
+}
+
+CSVIndexResult csv_index_save(const CSVRecordIndex *index, const char *path) {
+    if (!csv_index_is_built(index) || !path) return CSV_INDEX_ERROR_NULL_POINTER;
+
+    size_t path_length = strlen(path);
+    char *temp_path = malloc(path_length + 5);
+    if (!temp_path) return CSV_INDEX_ERROR_MEMORY_ALLOCATION;
+    memcpy(temp_path, path, path_length);
+    memcpy(temp_path + path_length, ".tmp", 5);
+
+    FILE *file = fopen(temp_path, "wb");
+    if (!file) {
+        free(temp_path);
+        return CSV_INDEX_ERROR_FILE_OPEN;
+    }
+
+    IndexFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, INDEX_FILE_MAGIC, sizeof(header.magic));
+    header.source_size = index->source_size;
+    header.source_mtime_sec = index->source_mtime_sec;
+    header.source_mtime_nsec = index->source_mtime_nsec;
+    header.record_count = index->record_count;
+    header.stride = index->stride;
+    header.count = index->count;
+    header.enclosure = (unsigned char)index->enclosure;
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    for (size_t i = 0; ok && i < index->count; i++) {
+        int64_t offset = (int64_t)index->offsets[i];
+        ok = fwrite(&offset, sizeof(offset), 1, file) == 1;
+    }
+    if (fclose(file) != 0) ok = false;
+
+    if (!ok || rename(temp_path, path) != 0) {
+        remove(temp_path);
+        free(temp_path);
+        return CSV_INDEX_ERROR_FILE_WRITE;
+    }
+
+    free(temp_path);
+    return CSV_INDEX_OK;
+}
+
+CSVIndexResult csv_index_load(CSVRecordIndex *index, const char *path, const CSVBuffer *source) {
+    if (!index || !path) return CSV_INDEX_ERROR_NULL_POINTER;
+
+    int64_t size, mtime_sec, mtime_nsec;
+    if (!source_stamp(source, &size, &mtime_sec, &mtime_nsec)) return CSV_INDEX_ERROR_STALE;
+
+    FILE *file = fopen(path, "rb");
+    if (!file) return CSV_INDEX_ERROR_FILE_OPEN;
+
+    IndexFileHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        memcmp(header.magic, INDEX_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.stride == 0 || header.count == 0 || header.record_count < 0 ||
+        header.count > (uint64_t)header.source_size + 1) {
+        fclose(file);
+        return CSV_INDEX_ERROR_INVALID_FORMAT;
+    }
+
+    if (header.source_size != size || header.source_mtime_sec != mtime_sec ||
+        header.source_mtime_nsec != mtime_nsec) {
+        fclose(file);
+        return CSV_INDEX_ERROR_STALE;
+    }
+
+    csv_index_free(index);
+    index->offsets = malloc((size_t)header.count * sizeof(off_t));
+    if (!index->offsets) {
+        fclose(file);
+        return CSV_INDEX_ERROR_MEMORY_ALLOCATION;
+    }
+
+    for (uint64_t i = 0; i < header.count; i++) {
+        int64_t offset;
+        if (fread(&offset, sizeof(offset), 1, file) != 1 || offset < 0 || offset > size) {
+            fclose(file);
+            csv_index_free(index);
+            return CSV_INDEX_ERROR_INVALID_FORMAT;
+        }
+        index->offsets[i] = (off_t)offset;
+    }
+    fclose(file);
+
+    index->count = (size_t)header.count;
+    index->capacity = index->count;
+    index->stride = (size_t)header.stride;
+    index->record_count = (long)header.record_count;
+    index->enclosure = (char)header.enclosure;
+    index->source_size = size;
+    index->source_mtime_sec = mtime_sec;
+    index->source_mtime_nsec = mtime_nsec;
+    return CSV_INDEX_OK;
+}
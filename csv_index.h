@@ -0,0 +1,49 @@
+#ifndef CSV_INDEX_H
+#define CSV_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/types.h>
+#include "csv_buffer.h"
+
+#define CSV_INDEX_DEFAULT_STRIDE 1024
+#define CSV_INDEX_SIDECAR_SUFFIX ".idx"
+
+typedef enum {
+    CSV_INDEX_OK = 0,
+    CSV_INDEX_ERROR_NULL_POINTER,
+    CSV_INDEX_ERROR_MEMORY_ALLOCATION,
+    CSV_INDEX_ERROR_FILE_OPEN,
+    CSV_INDEX_ERROR_FILE_READ,
+    CSV_INDEX_ERROR_FILE_WRITE,
+    CSV_INDEX_ERROR_INVALID_FORMAT,
+    CSV_INDEX_ERROR_STALE
+} CSVIndexResult;
+
+/* offsets[i] is the byte offset of data record i * stride. */
+typedef struct {
+    off_t *offsets;
+    size_t count;
+    size_t capacity;
+    size_t stride;
+    long record_count;
+    char enclosure;
+    int64_t source_size;
+    int64_t source_mtime_sec;
+    int64_t source_mtime_nsec;
+} CSVRecordIndex;
+
+void csv_index_init(CSVRecordIndex *index);
+void csv_index_free(CSVRecordIndex *index);
+bool csv_index_is_built(const CSVRecordIndex *index);
+
+CSVIndexResult csv_index_build(CSVRecordIndex *index, CSVBuffer *input, char enclosure, size_t stride);
+bool csv_index_lookup(const CSVRecordIndex *index, long record, off_t *offset, long *remaining);
+
+CSVIndexResult csv_index_save(const CSVRecordIndex *index, const char *path);
+CSVIndexResult csv_index_load(CSVRecordIndex *index, const char *path, const CSVBuffer *source);
+
+const char* csv_index_error_string(CSVIndexResult result);
+
+#endif
@@ -0,0 +1,595 @@
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE
+
+#include "csv_parallel.h"
+#include "csv_buffer.h"
+#include "csv_parser.h"
+#include "csv_simd.h"
+#include "csv_count.h"
+#include "arena.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define NO_RECORD_START ((size_t)-1)
+
+typedef struct {
+    size_t begin;
+    size_t end;
+    size_t first_record[2];
+    bool odd_quotes;
+
+    size_t record_start;
+    size_t record_end;
+
+    CSVFieldView *views;
+    size_t view_count;
+    size_t view_capacity;
+    size_t *field_counts;
+    size_t record_count;
+    size_t record_capacity;
+    bool done;
+    bool failed;
+    bool out_of_memory;
+} ParallelChunk;
+
+typedef struct {
+    const char *data;
+    size_t size;
+    const CSVConfig *config;
+    char delimiter;
+    char enclosure;
+    CSVParallelOrder order;
+    CSVParallelRecordCallback callback;
+    void *user_data;
+
+    ParallelChunk *chunks;
+    size_t chunk_count;
+    size_t next_chunk;
+    size_t delivered;
+    size_t window;
+    bool stop;
+    CSVParallelResult error;
+
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+} ParallelJob;
+
+typedef struct ParallelWorker ParallelWorker;
+typedef void (*ChunkTask)(ParallelWorker *worker, ParallelChunk *chunk);
+
+struct ParallelWorker {
+    ParallelJob *job;
+    int id;
+    ChunkTask task;
+    Arena arena;
+    size_t record_count;
+    pthread_t thread;
+};
+
+const char* csv_parallel_error_string(CSVParallelResult result) {
+    switch (result) {
+        case CSV_PARALLEL_OK: return "Success";
+        case CSV_PARALLEL_ERROR_NULL_POINTER: return "Null pointer error";
+        case CSV_PARALLEL_ERROR_MEMORY_ALLOCATION: return "Memory allocation failed";
+        case CSV_PARALLEL_ERROR_FILE_OPEN: return "Failed to open file";
+        case CSV_PARALLEL_ERROR_FILE_READ: return "Failed to read from file";
+        case CSV_PARALLEL_ERROR_THREAD: return "Failed to start worker thread";
+        case CSV_PARALLEL_ERROR_PARSE: return "Malformed CSV record";
+        default: return "Unknown error";
+    }
+}
+
+void csv_parallel_options_init(CSVParallelOptions *options) {
+    if (!options) return;
+
+    options->thread_count = 0;
+    options->chunk_size = CSV_PARALLEL_DEFAULT_CHUNK_SIZE;
+    options->order = CSV_PARALLEL_ORDERED;
+}
+
+static bool job_stopped(ParallelJob *job) {
+    return __atomic_load_n(&job->stop, __ATOMIC_ACQUIRE);
+}
+
+static void job_fail(ParallelJob *job, CSVParallelResult error) {
+    pthread_mutex_lock(&job->lock);
+    if (job->error == CSV_PARALLEL_OK) job->error = error;
+    __atomic_store_n(&job->stop, true, __ATOMIC_RELEASE);
+    pthread_cond_broadcast(&job->cond);
+    pthread_mutex_unlock(&job->lock);
+}
+
+static size_t record_start_after(const char *data, size_t size, size_t terminator) {
+    if (data[terminator] == '\r' && terminator + 1 < size && data[terminator + 1] == '\n') {
+        return terminator + 2;
+    }
+    return terminator + 1;
+}
+
+/*
+ * Speculation pass: a chunk does not know whether its first byte sits
+ * inside a quoted field. Quote parity does not depend on that, and the
+ * first record start under either assumption falls out of the same prefix
+ * XOR mask (inside for one assumption is outside for the other), so one
+ * indexed pass over the chunk resolves both and the stitch becomes a scan
+ * over chunk parities.
+ */
+static void speculate_chunk(ParallelWorker *worker, ParallelChunk *chunk) {
+    const ParallelJob *job = worker->job;
+    char padded[CSV_SIMD_BLOCK_SIZE];
+    uint64_t carry = 0;
+    unsigned int quote_count = 0;
+
+    chunk->first_record[0] = NO_RECORD_START;
+    chunk->first_record[1] = NO_RECORD_START;
+
+    for (size_t pos = chunk->begin; pos < chunk->end; pos += CSV_SIMD_BLOCK_SIZE) {
+        size_t available = chunk->end - pos;
+        const char *block = job->data + pos;
+        uint64_t valid = ~(uint64_t)0;
+
+        if (available < CSV_SIMD_BLOCK_SIZE) {
+            memset(padded, 0, sizeof(padded));
+            memcpy(padded, block, available);
+            block = padded;
+            valid = ((uint64_t)1 << available) - 1;
+        }
+
+        CSVStructuralMasks masks;
+        csv_simd_index_block(block, job->delimiter, job->enclosure, &masks);
+        uint64_t quotes = masks.enclosure & valid;
+        uint64_t newlines = masks.newline & valid;
+
+        if (chunk->first_record[0] == NO_RECORD_START || chunk->first_record[1] == NO_RECORD_START) {
+            uint64_t inside = csv_simd_prefix_xor(quotes) ^ carry;
+            uint64_t outside_terminators = newlines & ~inside;
+            uint64_t inside_terminators = newlines & inside;
+
+            if (chunk->first_record[0] == NO_RECORD_START && outside_terminators) {
+                size_t terminator = pos + (size_t)__builtin_ctzll(outside_terminators);
+                chunk->first_record[0] = record_start_after(job->data, job->size, terminator);
+            }
+            if (chunk->first_record[1] == NO_RECORD_START && inside_terminators) {
+                size_t terminator = pos + (size_t)__builtin_ctzll(inside_terminators);
+                chunk->first_record[1] = record_start_after(job->data, job->size, terminator);
+            }
+            carry = (uint64_t)0 - (inside >> 63);
+        }
+
+        quote_count += (unsigned int)__builtin_popcountll(quotes);
+    }
+
+    chunk->odd_quotes = (quote_count & 1) != 0;
+}
+
+static void stitch_chunks(ParallelJob *job) {
+    bool in_quotes = false;
+
+    for (size_t i = 0; i < job->chunk_count; i++) {
+        ParallelChunk *chunk = &job->chunks[i];
+        chunk->record_start = i == 0 ? chunk->begin : chunk->first_record[in_quotes ? 1 : 0];
+        in_quotes ^= chunk->odd_quotes;
+    }
+
+    size_t next_start = job->size;
+    for (size_t i = job->chunk_count; i-- > 0;) {
+        ParallelChunk *chunk = &job->chunks[i];
+        if (chunk->record_start == NO_RECORD_START || chunk->record_start > next_start) {
+            chunk->record_start = next_start;
+        }
+        chunk->record_end = next_start;
+        next_start = chunk->record_start;
+    }
+}
+
+static bool store_record(ParallelChunk *chunk, const FieldViewArray *fields) {
+    if (chunk->record_count == chunk->record_capacity) {
+        size_t capacity = chunk->record_capacity ? chunk->record_capacity * 2 : 256;
+        size_t *counts = realloc(chunk->field_counts, capacity * sizeof(size_t));
+        if (!counts) return false;
+        chunk->field_counts = counts;
+        chunk->record_capacity = capacity;
+    }
+
+    if (chunk->view_count + fields->count > chunk->view_capacity) {
+        size_t capacity = chunk->view_capacity ? chunk->view_capacity : 1024;
+        while (capacity < chunk->view_count + fields->count) capacity *= 2;
+        CSVFieldView *views = realloc(chunk->views, capacity * sizeof(CSVFieldView));
+        if (!views) return false;
+        chunk->views = views;
+        chunk->view_capacity = capacity;
+    }
+
+    if (fields->count > 0) {
+        memcpy(chunk->views + chunk->view_count, fields->fields, fields->count * sizeof(CSVFieldView));
+    }
+    chunk->view_count += fields->count;
+    chunk->field_counts[chunk->record_count++] = fields->count;
+    return true;
+}
+
+static void release_chunk_records(ParallelChunk *chunk) {
+    free(chunk->views);
+    free(chunk->field_counts);
+    chunk->views = NULL;
+    chunk->field_counts = NULL;
+    chunk->view_count = chunk->view_capacity = 0;
+    chunk->record_count = chunk->record_capacity = 0;
+}
+
+static void parse_chunk(ParallelWorker *worker, ParallelChunk *chunk) {
+    ParallelJob *job = worker->job;
+    CSVBuffer input;
+
+    if (csv_buffer_open_memory(&input, job->data + chunk->record_start,
+                               chunk->record_end - chunk->record_start) != CSV_BUFFER_OK) {
+        chunk->failed = true;
+        return;
+    }
+
+    int line_number = 0;
+    size_t length;
+    const char *line;
+
+    while (!job_stopped(job) && (line = csv_buffer_next_record(&input, job->enclosure, &length))) {
+        arena_reset(&worker->arena);
+        line_number++;
+
+        CSVParseViewResult parsed = csv_parse_line_views(line, length, &worker->arena, job->config, line_number);
+        if (!parsed.success) {
+            chunk->failed = true;
+            break;
+        }
+
+        if (job->order == CSV_PARALLEL_ORDERED) {
+            if (!store_record(chunk, &parsed.fields)) {
+                chunk->failed = true;
+                chunk->out_of_memory = true;
+                break;
+            }
+            continue;
+        }
+
+        CSVRecordView record = { parsed.fields.fields, parsed.fields.count, job->enclosure };
+        worker->record_count++;
+        if (!job->callback(&record, worker->id, job->user_data)) {
+            __atomic_store_n(&job->stop, true, __ATOMIC_RELEASE);
+            break;
+        }
+    }
+
+    csv_buffer_close(&input);
+
+    if (chunk->failed && job->order == CSV_PARALLEL_UNORDERED) {
+        job_fail(job, CSV_PARALLEL_ERROR_PARSE);
+    }
+}
+
+static void count_chunk(ParallelWorker *worker, ParallelChunk *chunk) {
+    const ParallelJob *job = worker->job;
+    long counted = csv_count_records(job->data + chunk->record_start, chunk->record_end - chunk->record_start,
+                                     job->enclosure, job->config->skipEmptyLines, 0);
+    if (counted > 0) worker->record_count += (size_t)counted;
+}
+
+static void* worker_main(void *arg) {
+    ParallelWorker *worker = arg;
+    ParallelJob *job = worker->job;
+    bool windowed = worker->task == parse_chunk && job->order == CSV_PARALLEL_ORDERED;
+
+    pthread_mutex_lock(&job->lock);
+    for (;;) {
+        while (windowed && !job_stopped(job) && job->next_chunk < job->chunk_count &&
+               job->next_chunk >= job->delivered + job->window) {
+            pthread_cond_wait(&job->cond, &job->lock);
+        }
+        if (job_stopped(job) || job->next_chunk >= job->chunk_count) break;
+
+        ParallelChunk *chunk = &job->chunks[job->next_chunk++];
+        pthread_mutex_unlock(&job->lock);
+
+        worker->task(worker, chunk);
+
+        pthread_mutex_lock(&job->lock);
+        chunk->done = true;
+        pthread_cond_broadcast(&job->cond);
+    }
+    pthread_mutex_unlock(&job->lock);
+
+    return NULL;
+}
+
+static size_t deliver_ordered(ParallelJob *job) {
+    size_t delivered_records = 0;
+
+    for (size_t i = 0; i < job->chunk_count; i++) {
+        ParallelChunk *chunk = &job->chunks[i];
+
+        pthread_mutex_lock(&job->lock);
+        while (!chunk->done && !job_stopped(job)) {
+            pthread_cond_wait(&job->cond, &job->lock);
+        }
+        pthread_mutex_unlock(&job->lock);
+        if (job_stopped(job)) break;
+
+        bool keep_going = true;
+        CSVFieldView *fields = chunk->views;
+        for (size_t r = 0; r < chunk->record_count && keep_going; r++) {
+            CSVRecordView record = { fields, chunk->field_counts[r], job->enclosure };
+            fields += chunk->field_counts[r];
+            delivered_records++;
+            keep_going = job->callback(&record, 0, job->user_data);
+        }
+
+        bool failed = chunk->failed;
+        bool out_of_memory = chunk->out_of_memory;
+        release_chunk_records(chunk);
+
+        if (keep_going && failed) {
+            job_fail(job, out_of_memory ? CSV_PARALLEL_ERROR_MEMORY_ALLOCATION : CSV_PARALLEL_ERROR_PARSE);
+            break;
+        }
+
+        pthread_mutex_lock(&job->lock);
+        job->delivered = i + 1;
+        if (!keep_going) __atomic_store_n(&job->stop, true, __ATOMIC_RELEASE);
+        pthread_cond_broadcast(&job->cond);
+        pthread_mutex_unlock(&job->lock);
+
+        if (!keep_going) break;
+    }
+
+    return delivered_records;
+}
+
+static size_t run_phase(ParallelJob *job, ParallelWorker *workers, int thread_count, ChunkTask task) {
+    job->next_chunk = 0;
+    job->delivered = 0;
+    for (size_t i = 0; i < job->chunk_count; i++) {
+        job->chunks[i].done = false;
+    }
+
+    int started = 0;
+    for (int i = 0; i < thread_count; i++) {
+        workers[i].task = task;
+        if (pthread_create(&workers[i].thread, NULL, worker_main, &workers[i]) != 0) {
+            job_fail(job, CSV_PARALLEL_ERROR_THREAD);
+            break;
+        }
+        started++;
+    }
+
+    size_t delivered_records = 0;
+    if (started > 0 && task == parse_chunk && job->order == CSV_PARALLEL_ORDERED) {
+        delivered_records = deliver_ordered(job);
+    }
+
+    for (int i = 0; i < started; i++) {
+        pthread_join(workers[i].thread, NULL);
+    }
+
+    return delivered_records;
+}
+
+static int resolve_thread_count(int requested) {
+    if (requested <= 0) {
+        long online = 1;
+#ifdef _SC_NPROCESSORS_ONLN
+        /* Darwin hides it under _POSIX_C_SOURCE; one thread is the fallback. */
+        online = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+        requested = online > 0 ? (int)online : 1;
+    }
+    if (requested > CSV_PARALLEL_MAX_THREADS) requested = CSV_PARALLEL_MAX_THREADS;
+    return requested;
+}
+
+static CSVParallelResult read_sequential(const CSVConfig *config, CSVParallelRecordCallback callback,
+                                         void *user_data, CSVParallelStats *stats) {
+    CSVBuffer input;
+    if (csv_buffer_open(&input, config->path, CSV_BUFFER_DEFAULT_SIZE) != CSV_BUFFER_OK) {
+        return CSV_PARALLEL_ERROR_FILE_OPEN;
+    }
+
+    Arena arena;
+    if (arena_create_growable(&arena, ARENA_DEFAULT_SIZE, 0) != ARENA_OK) {
+        csv_buffer_close(&input);
+        return CSV_PARALLEL_ERROR_MEMORY_ALLOCATION;
+    }
+
+    char enclosure = csv_config_get_enclosure(config);
+    int line_number = 0;
+    if (config->hasHeader && csv_buffer_next_record(&input, enclosure, NULL)) {
+        line_number++;
+    }
+
+    CSVParallelResult result = CSV_PARALLEL_OK;
+    size_t record_count = 0;
+    size_t length;
+    const char *line;
+
+    while ((line = csv_buffer_next_record(&input, enclosure, &length))) {
+        arena_reset(&arena);
+        line_number++;
+
+        CSVParseViewResult parsed = csv_parse_line_views(line, length, &arena, config, line_number);
+        if (!parsed.success) {
+            result = CSV_PARALLEL_ERROR_PARSE;
+            break;
+        }
+
+        CSVRecordView record = { parsed.fields.fields, parsed.fields.count, enclosure };
+        record_count++;
+        if (!callback(&record, 0, user_data)) break;
+    }
+
+    if (result == CSV_PARALLEL_OK && input.error != CSV_BUFFER_OK) {
+        result = CSV_PARALLEL_ERROR_FILE_READ;
+    }
+
+    if (stats) {
+        stats->record_count = record_count;
+        stats->chunk_count = 1;
+        stats->thread_count = 1;
+    }
+
+    arena_destroy(&arena);
+    csv_buffer_close(&input);
+    return result;
+}
+
+static CSVParallelResult run_job(ParallelJob *job, CSVBuffer *input, const CSVParallelOptions *options,
+                                 ChunkTask task, CSVParallelStats *stats) {
+    job->data = input->data;
+    job->size = input->end;
+
+    if (job->config->hasHeader) {
+        csv_buffer_next_record(input, job->enclosure, NULL);
+    }
+    size_t data_start = (size_t)csv_buffer_tell(input);
+
+    size_t chunk_size = options->chunk_size ? options->chunk_size : CSV_PARALLEL_DEFAULT_CHUNK_SIZE;
+    if (chunk_size < CSV_PARALLEL_MIN_CHUNK_SIZE) chunk_size = CSV_PARALLEL_MIN_CHUNK_SIZE;
+    job->chunk_count = (job->size - data_start + chunk_size - 1) / chunk_size;
+
+    int thread_count = resolve_thread_count(options->thread_count);
+    if ((size_t)thread_count > job->chunk_count) thread_count = (int)job->chunk_count;
+
+    if (job->chunk_count == 0) {
+        csv_buffer_close(input);
+        return CSV_PARALLEL_OK;
+    }
+
+    job->window = (size_t)thread_count * 2;
+    job->chunks = calloc(job->chunk_count, sizeof(ParallelChunk));
+    ParallelWorker *workers = calloc((size_t)thread_count, sizeof(ParallelWorker));
+    if (!job->chunks || !workers) {
+        free(job->chunks);
+        free(workers);
+        csv_buffer_close(input);
+        return CSV_PARALLEL_ERROR_MEMORY_ALLOCATION;
+    }
+
+    for (size_t i = 0; i < job->chunk_count; i++) {
+        job->chunks[i].begin = data_start + i * chunk_size;
+        job->chunks[i].end = job->chunks[i].begin + chunk_size < job->size ? job->chunks[i].begin + chunk_size : job->size;
+    }
+
+    int arenas_created = 0;
+    for (int i = 0; i < thread_count; i++) {
+        workers[i].job = job;
+        workers[i].id = i;
+        if (arena_create_growable(&workers[i].arena, ARENA_DEFAULT_SIZE, 0) != ARENA_OK) {
+            job->error = CSV_PARALLEL_ERROR_MEMORY_ALLOCATION;
+            break;
+        }
+        arenas_created++;
+    }
+
+    pthread_mutex_init(&job->lock, NULL);
+    pthread_cond_init(&job->cond, NULL);
+    csv_simd_get_level();
+
+    size_t record_count = 0;
+    if (job->error == CSV_PARALLEL_OK) {
+        run_phase(job, workers, thread_count, speculate_chunk);
+    }
+    if (job->error == CSV_PARALLEL_OK) {
+        stitch_chunks(job);
+        record_count = run_phase(job, workers, thread_count, task);
+    }
+    if (task != parse_chunk || job->order == CSV_PARALLEL_UNORDERED) {
+        for (int i = 0; i < thread_count; i++) {
+            record_count += workers[i].record_count;
+        }
+    }
+
+    if (stats) {
+        stats->record_count = record_count;
+        stats->chunk_count = job->chunk_count;
+        stats->thread_count = thread_count;
+    }
+
+    CSVParallelResult result = job->error;
+    for (size_t i = 0; i < job->chunk_count; i++) {
+        release_chunk_records(&job->chunks[i]);
+    }
+    for (int i = 0; i < arenas_created; i++) {
+        arena_destroy(&workers[i].arena);
+    }
+    pthread_cond_destroy(&job->cond);
+    pthread_mutex_destroy(&job->lock);
+    free(workers);
+    free(job->chunks);
+    csv_buffer_close(input);
+    return result;
+}
+
+CSVParallelResult csv_parallel_read(const CSVConfig *config, const CSVParallelOptions *options,
+                                    CSVParallelRecordCallback callback, void *user_data,
+                                    CSVParallelStats *stats) {
+    if (!config || !callback) return CSV_PARALLEL_ERROR_NULL_POINTER;
+
+    CSVParallelOptions defaults;
+    if (!options) {
+        csv_parallel_options_init(&defaults);
+        options = &defaults;
+    }
+    if (stats) memset(stats, 0, sizeof(CSVParallelStats));
+
+    CSVBuffer input;
+    CSVBufferResult opened = csv_buffer_open_mapped(&input, config->path);
+    if (opened == CSV_BUFFER_ERROR_FILE_OPEN) return CSV_PARALLEL_ERROR_FILE_OPEN;
+    if (opened != CSV_BUFFER_OK) return read_sequential(config, callback, user_data, stats);
+
+    ParallelJob job;
+    memset(&job, 0, sizeof(ParallelJob));
+    job.config = config;
+    job.delimiter = csv_config_get_delimiter(config);
+    job.enclosure = csv_config_get_enclosure(config);
+    job.order = options->order;
+    job.callback = callback;
+    job.user_data = user_data;
+
+    return run_job(&job, &input, options, parse_chunk, stats);
+}
+
+CSVParallelResult csv_parallel_count(const CSVConfig *config, const CSVParallelOptions *options, long *count) {
+    if (!config || !count) return CSV_PARALLEL_ERROR_NULL_POINTER;
+
+    CSVParallelOptions defaults;
+    if (!options) {
+        csv_parallel_options_init(&defaults);
+        options = &defaults;
+    }
+    *count = 0;
+
+    char enclosure = csv_config_get_enclosure(config);
+    CSVBuffer input;
+    CSVBufferResult opened = csv_buffer_open_mapped(&input, config->path);
+    if (opened == CSV_BUFFER_ERROR_FILE_OPEN) return CSV_PARALLEL_ERROR_FILE_OPEN;
+
+    if (opened != CSV_BUFFER_OK) {
+        if (csv_buffer_open(&input, config->path, 0) != CSV_BUFFER_OK) return CSV_PARALLEL_ERROR_FILE_OPEN;
+        long counted = csv_count_fd(input.fd, enclosure, config->skipEmptyLines, config->hasHeader ? 1 : 0);
+        csv_buffer_close(&input);
+        if (counted < 0) return CSV_PARALLEL_ERROR_FILE_READ;
+        *count = counted;
+        return CSV_PARALLEL_OK;
+    }
+
+    ParallelJob job;
+    memset(&job, 0, sizeof(ParallelJob));
+    job.config = config;
+    job.delimiter = csv_config_get_delimiter(config);
+    job.enclosure = enclosure;
+    job.order = CSV_PARALLEL_UNORDERED;
+
+    CSVParallelStats stats;
+    memset(&stats, 0, sizeof(stats));
+    CSVParallelResult result = run_job(&job, &input, options, count_chunk, &stats);
+    if (result == CSV_PARALLEL_OK) *count = (long)stats.record_count;
+    return result;
+}
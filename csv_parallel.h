@@ -0,0 +1,59 @@
+#ifndef CSV_PARALLEL_H
+#define CSV_PARALLEL_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "csv_config.h"
+#include "csv_reader.h"
+
+#define CSV_PARALLEL_DEFAULT_CHUNK_SIZE (4 * 1024 * 1024)
+#define CSV_PARALLEL_MIN_CHUNK_SIZE 4096
+#define CSV_PARALLEL_MAX_THREADS 64
+
+typedef enum {
+    CSV_PARALLEL_OK = 0,
+    CSV_PARALLEL_ERROR_NULL_POINTER,
+    CSV_PARALLEL_ERROR_MEMORY_ALLOCATION,
+    CSV_PARALLEL_ERROR_FILE_OPEN,
+    CSV_PARALLEL_ERROR_FILE_READ,
+    CSV_PARALLEL_ERROR_THREAD,
+    CSV_PARALLEL_ERROR_PARSE
+} CSVParallelResult;
+
+typedef enum {
+    CSV_PARALLEL_ORDERED,
+    CSV_PARALLEL_UNORDERED
+} CSVParallelOrder;
+
+typedef struct {
+    int thread_count;
+    size_t chunk_size;
+    CSVParallelOrder order;
+} CSVParallelOptions;
+
+typedef struct {
+    size_t record_count;
+    size_t chunk_count;
+    int thread_count;
+} CSVParallelStats;
+
+/*
+ * Called once per data record; return false to stop reading. In ordered
+ * mode every call happens on the calling thread with worker 0. In unordered
+ * mode calls come concurrently from the workers, identified by worker.
+ * Field views point into the mapped file and are only valid during the call.
+ */
+typedef bool (*CSVParallelRecordCallback)(const CSVRecordView *record, int worker, void *user_data);
+
+void csv_parallel_options_init(CSVParallelOptions *options);
+
+CSVParallelResult csv_parallel_read(const CSVConfig *config, const CSVParallelOptions *options,
+                                    CSVParallelRecordCallback callback, void *user_data,
+                                    CSVParallelStats *stats);
+
+/* Counts data records, honouring hasHeader and skipEmptyLines, without parsing fields. */
+CSVParallelResult csv_parallel_count(const CSVConfig *config, const CSVParallelOptions *options, long *count);
+
+const char* csv_parallel_error_string(CSVParallelResult result);
+
+#endif
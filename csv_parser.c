@@ -1,10 +1,37 @@
 #include "csv_parser.h"
+#include "csv_simd.h"
 #include "arena.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
 
+typedef struct {
+    FieldArray *strings;
+    FieldViewArray *views;
+    Arena *arena;
+    char enclosure;
+    const CSVProjection *projection;
+    const CSVParseTable *table;
+    bool unquoted;
+    char *empty;
+    size_t column;
+    size_t pending;
+} FieldSink;
+
+typedef enum {
+    SPLIT_OK,
+    SPLIT_IRREGULAR,
+    SPLIT_NO_MEMORY
+} SplitStatus;
+
+typedef enum {
+    SCAN_FIELD,
+    SCAN_QUOTED,
+    SCAN_CLOSED,
+    SCAN_SKIP
+} ScanState;
+
 static void init_field_array(FieldArray *arr, Arena *arena, size_t initial_capacity) {
     void *ptr;
     ArenaResult result = arena_alloc(arena, sizeof(char*) * initial_capacity, &ptr);
@@ -21,37 +48,107 @@ static void init_field_array(FieldArray *arr, Arena *arena, size_t initial_capac
 
 static bool grow_field_array(FieldArray *arr, Arena *arena) {
     size_t new_capacity = arr->capacity * 2;
-    void *ptr;
-    ArenaResult result = arena_alloc(arena, sizeof(char*) * new_capacity, &ptr);
-    if (result != ARENA_OK) {
+    char **new_fields = arena_realloc(arena, arr->fields, sizeof(char*) * arr->capacity,
+                                      sizeof(char*) * new_capacity);
+    if (!new_fields) {
         return false;
     }
-    char **new_fields = (char**)ptr;
-    memcpy(new_fields, arr->fields, sizeof(char*) * arr->count);
     arr->fields = new_fields;
     arr->capacity = new_capacity;
     return true;
 }
 
-static bool add_field(FieldArray *arr, const char *start, size_t len, Arena *arena) {
-    if (arr->count >= arr->capacity) {
-        if (!grow_field_array(arr, arena)) {
-            return false;
-        }
+static void init_view_array(FieldViewArray *arr, Arena *arena, size_t initial_capacity) {
+    void *ptr;
+    ArenaResult result = arena_alloc(arena, sizeof(CSVFieldView) * initial_capacity, &ptr);
+    if (result != ARENA_OK) {
+        arr->fields = NULL;
+        arr->count = 0;
+        arr->capacity = 0;
+        return;
     }
+    arr->fields = (CSVFieldView*)ptr;
+    arr->count = 0;
+    arr->capacity = initial_capacity;
+}
 
+static bool grow_view_array(FieldViewArray *arr, Arena *arena) {
+    size_t new_capacity = arr->capacity * 2;
+    CSVFieldView *new_fields = arena_realloc(arena, arr->fields, sizeof(CSVFieldView) * arr->capacity,
+                                             sizeof(CSVFieldView) * new_capacity);
+    if (!new_fields) {
+        return false;
+    }
+    arr->fields = new_fields;
+    arr->capacity = new_capacity;
+    return true;
+}
+
+static size_t trimmed_length(const char *start, size_t len) {
     while (len > 0 && (start[len-1] == ' ' || start[len-1] == '\t')) {
         len--;
     }
+    return len;
+}
+
+static size_t unescape_into(char *dest, const char *src, size_t len, char enclosure) {
+    const char *p = src;
+    const char *end = src + len;
+    size_t write_pos = 0;
+
+    while (p < end) {
+        const char *q = memchr(p, enclosure, end - p);
+        if (!q) {
+            memcpy(dest + write_pos, p, end - p);
+            write_pos += end - p;
+            break;
+        }
+        memcpy(dest + write_pos, p, q - p);
+        write_pos += q - p;
+        dest[write_pos++] = enclosure;
+        p = (q + 1 < end && q[1] == enclosure) ? q + 2 : q + 1;
+    }
+
+    return write_pos;
+}
+
+static char* copy_field(const char *start, size_t len, Arena *arena) {
+    len = trimmed_length(start, len);
 
     void *ptr;
     ArenaResult result = arena_alloc(arena, len + 1, &ptr);
     if (result != ARENA_OK) {
-        return false;
+        return NULL;
     }
     char *field = (char*)ptr;
     memcpy(field, start, len);
     field[len] = '\0';
+    return field;
+}
+
+static char* copy_quoted_field(const char *start, size_t len, Arena *arena, char enclosure) {
+    void *ptr;
+    ArenaResult result = arena_alloc(arena, len + 1, &ptr);
+    if (result != ARENA_OK) {
+        return NULL;
+    }
+
+    char *field = (char*)ptr;
+    field[unescape_into(field, start, len, enclosure)] = '\0';
+    return field;
+}
+
+static bool add_field(FieldArray *arr, const char *start, size_t len, Arena *arena) {
+    if (arr->count >= arr->capacity) {
+        if (!grow_field_array(arr, arena)) {
+            return false;
+        }
+    }
+
+    char *field = copy_field(start, len, arena);
+    if (!field) {
+        return false;
+    }
     arr->fields[arr->count++] = field;
     return true;
 }
@@ -63,30 +160,697 @@ static bool add_quoted_field(FieldArray *arr, const char *start, size_t len, Are
         }
     }
 
-    void *ptr;
-    ArenaResult result = arena_alloc(arena, len + 1, &ptr);
-    if (result != ARENA_OK) {
+    char *field = copy_quoted_field(start, len, arena, enclosure);
+    if (!field) {
         return false;
     }
-    
-    char *field = (char*)ptr;
-    size_t write_pos = 0;
-    
-    for (size_t i = 0; i < len; i++) {
-        if (start[i] == enclosure && i + 1 < len && start[i + 1] == enclosure) {
-            field[write_pos++] = enclosure;
-            i++;
+    arr->fields[arr->count++] = field;
+    return true;
+}
+
+static void set_view(CSVFieldView *view, const char *start, size_t len, bool quoted, char enclosure) {
+    view->data = start;
+    if (quoted) {
+        view->length = len;
+        view->needs_unescape = len > 0 && memchr(start, enclosure, len) != NULL;
+    } else {
+        view->length = trimmed_length(start, len);
+        view->needs_unescape = false;
+    }
+}
+
+static bool add_view(FieldViewArray *arr, const char *start, size_t len, bool quoted, Arena *arena, char enclosure) {
+    if (arr->count >= arr->capacity) {
+        if (!grow_view_array(arr, arena)) {
+            return false;
+        }
+    }
+
+    set_view(&arr->fields[arr->count++], start, len, quoted, enclosure);
+    return true;
+}
+
+/*
+ * Projected sinks receive every field of the line but only copy the ones
+ * that map to an output slot; the rest cost a column counter bump. Once the
+ * last projected column has been stored, pending drops to zero and the
+ * splitters stop scanning the line.
+ */
+static bool sink_projected(FieldSink *sink, const char *start, size_t len, bool quoted) {
+    size_t column = sink->column++;
+    if (column >= sink->projection->column_count) {
+        return true;
+    }
+    int slot = sink->projection->slots[column];
+    if (slot < 0) {
+        return true;
+    }
+
+    sink->pending--;
+    if (sink->views) {
+        set_view(&sink->views->fields[slot], start, len, quoted, sink->enclosure);
+        return true;
+    }
+
+    char *field = quoted ? copy_quoted_field(start, len, sink->arena, sink->enclosure)
+                         : copy_field(start, len, sink->arena);
+    if (!field) {
+        return false;
+    }
+    sink->strings->fields[slot] = field;
+    return true;
+}
+
+static bool sink_field(FieldSink *sink, const char *start, size_t len, bool quoted) {
+    if (sink->projection) {
+        return sink_projected(sink, start, len, quoted);
+    }
+    if (sink->views) {
+        return add_view(sink->views, start, len, quoted, sink->arena, sink->enclosure);
+    }
+    if (quoted) {
+        return add_quoted_field(sink->strings, start, len, sink->arena, sink->enclosure);
+    }
+    return add_field(sink->strings, start, len, sink->arena);
+}
+
+static bool sink_span(FieldSink *sink, const char *start, size_t len) {
+    if (len > 0 && start[0] == sink->enclosure) {
+        return sink_field(sink, start + 1, len - 2, true);
+    }
+    return sink_field(sink, start, len, false);
+}
+
+/*
+ * Splits a line using the structural bitmasks from csv_simd_index_block.
+ * In-quote regions come from a prefix XOR over the enclosure bits, so
+ * delimiters inside quotes drop out of the mask without any per-byte
+ * state. Lines whose quoting the state machine would treat specially
+ * (quotes that do not open a field, text after a closing quote, unclosed
+ * quotes) are reported as irregular and left to the scalar parser so the
+ * output is always identical.
+ */
+static SplitStatus split_line_indexed(const char *line, size_t len, const CSVConfig *config, FieldSink *sink) {
+    const char delimiter = config->delimiter;
+    const char enclosure = config->enclosure;
+    char tail[CSV_SIMD_BLOCK_SIZE];
+    CSVStructuralMasks masks;
+    uint64_t in_quote_carry = 0;
+    uint64_t delim_carry = 1;
+    uint64_t closer_carry = 0;
+    size_t field_start = 0;
+
+    for (size_t base = 0; base < len; base += CSV_SIMD_BLOCK_SIZE) {
+        const char *block = line + base;
+        size_t remaining = len - base;
+        uint64_t valid = ~(uint64_t)0;
+
+        if (remaining < CSV_SIMD_BLOCK_SIZE) {
+            memset(tail, 0, sizeof(tail));
+            memcpy(tail, block, remaining);
+            block = tail;
+            valid = ((uint64_t)1 << remaining) - 1;
+        }
+
+        csv_simd_index_block(block, delimiter, enclosure, &masks);
+
+        uint64_t quotes = masks.enclosure & valid;
+        uint64_t inside = csv_simd_prefix_xor(quotes) ^ in_quote_carry;
+        uint64_t delims = masks.delimiter & ~inside & valid;
+        uint64_t openers = quotes & inside;
+        uint64_t closers = quotes & ~inside;
+        uint64_t after_delim = (delims << 1) | delim_carry;
+        uint64_t after_closer = (closers << 1) | closer_carry;
+
+        if ((openers & ~(after_delim | after_closer)) | (after_closer & ~(delims | openers) & valid)) {
+            return SPLIT_IRREGULAR;
+        }
+
+        in_quote_carry = (uint64_t)0 - (inside >> 63);
+        delim_carry = delims >> 63;
+        closer_carry = closers >> 63;
+
+        while (delims) {
+            size_t pos = base + (size_t)__builtin_ctzll(delims);
+            if (!sink_span(sink, line + field_start, pos - field_start)) {
+                return SPLIT_NO_MEMORY;
+            }
+            if (sink->pending == 0) {
+                return SPLIT_OK;
+            }
+            field_start = pos + 1;
+            delims &= delims - 1;
+        }
+    }
+
+    if (in_quote_carry) {
+        return SPLIT_IRREGULAR;
+    }
+
+    /* The state machine drops a trailing empty quoted field; keep parity. */
+    size_t last_len = len - field_start;
+    if (last_len == 2 && line[field_start] == enclosure) {
+        return SPLIT_OK;
+    }
+
+    if (!sink_span(sink, line + field_start, last_len)) {
+        return SPLIT_NO_MEMORY;
+    }
+    return SPLIT_OK;
+}
+
+enum {
+    CLASS_OTHER,
+    CLASS_DELIMITER,
+    CLASS_ENCLOSURE,
+    CLASS_DELIMITER_ENCLOSURE,
+    CLASS_BLANK
+};
+
+enum {
+    ACTION_NONE,
+    ACTION_OPEN_UNQUOTED,
+    ACTION_OPEN_QUOTED,
+    ACTION_CLOSE_QUOTE,
+    ACTION_EMIT_EMPTY,
+    ACTION_EMIT_UNQUOTED,
+    ACTION_EMIT_QUOTED,
+    ACTION_ERROR
+};
+
+#define TRANSITION(state, action) ((uint8_t)((state) | ((action) << 3)))
+
+/*
+ * QUOTE_IN_QUOTED_FIELD is a quote seen inside a quoted field: another
+ * quote makes it an escaped pair, anything else closes the field. Field
+ * lengths come from positions recorded by the actions, so ordinary bytes
+ * are a single lookup with no action.
+ */
+static const uint8_t base_transitions[CSV_PARSE_STATE_COUNT][CSV_PARSE_CLASS_COUNT] = {
+    [FIELD_START] = {
+        [CLASS_OTHER] = TRANSITION(UNQUOTED_FIELD, ACTION_OPEN_UNQUOTED),
+        [CLASS_DELIMITER] = TRANSITION(FIELD_START, ACTION_EMIT_EMPTY),
+        [CLASS_ENCLOSURE] = TRANSITION(QUOTED_FIELD, ACTION_OPEN_QUOTED),
+        [CLASS_DELIMITER_ENCLOSURE] = TRANSITION(QUOTED_FIELD, ACTION_OPEN_QUOTED),
+        [CLASS_BLANK] = TRANSITION(UNQUOTED_FIELD, ACTION_OPEN_UNQUOTED)
+    },
+    [UNQUOTED_FIELD] = {
+        [CLASS_OTHER] = TRANSITION(UNQUOTED_FIELD, ACTION_NONE),
+        [CLASS_DELIMITER] = TRANSITION(FIELD_START, ACTION_EMIT_UNQUOTED),
+        [CLASS_ENCLOSURE] = TRANSITION(UNQUOTED_FIELD, ACTION_NONE),
+        [CLASS_DELIMITER_ENCLOSURE] = TRANSITION(FIELD_START, ACTION_EMIT_UNQUOTED),
+        [CLASS_BLANK] = TRANSITION(UNQUOTED_FIELD, ACTION_NONE)
+    },
+    [QUOTED_FIELD] = {
+        [CLASS_OTHER] = TRANSITION(QUOTED_FIELD, ACTION_NONE),
+        [CLASS_DELIMITER] = TRANSITION(QUOTED_FIELD, ACTION_NONE),
+        [CLASS_ENCLOSURE] = TRANSITION(QUOTE_IN_QUOTED_FIELD, ACTION_CLOSE_QUOTE),
+        [CLASS_DELIMITER_ENCLOSURE] = TRANSITION(QUOTE_IN_QUOTED_FIELD, ACTION_CLOSE_QUOTE),
+        [CLASS_BLANK] = TRANSITION(QUOTED_FIELD, ACTION_NONE)
+    },
+    [QUOTE_IN_QUOTED_FIELD] = {
+        [CLASS_OTHER] = TRANSITION(FIELD_END, ACTION_ERROR),
+        [CLASS_DELIMITER] = TRANSITION(FIELD_START, ACTION_EMIT_QUOTED),
+        [CLASS_ENCLOSURE] = TRANSITION(QUOTED_FIELD, ACTION_NONE),
+        [CLASS_DELIMITER_ENCLOSURE] = TRANSITION(QUOTED_FIELD, ACTION_NONE),
+        [CLASS_BLANK] = TRANSITION(FIELD_END, ACTION_NONE)
+    },
+    [FIELD_END] = {
+        [CLASS_OTHER] = TRANSITION(FIELD_END, ACTION_ERROR),
+        [CLASS_DELIMITER] = TRANSITION(FIELD_START, ACTION_EMIT_QUOTED),
+        [CLASS_ENCLOSURE] = TRANSITION(FIELD_END, ACTION_ERROR),
+        [CLASS_DELIMITER_ENCLOSURE] = TRANSITION(FIELD_START, ACTION_EMIT_QUOTED),
+        [CLASS_BLANK] = TRANSITION(FIELD_END, ACTION_NONE)
+    }
+};
+
+static bool is_blank_byte(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+void csv_parse_table_build(CSVParseTable *table, const CSVConfig *config) {
+    const char delimiter = config->delimiter;
+    const char enclosure = config->enclosure;
+
+    memset(table->classes, CLASS_OTHER, sizeof(table->classes));
+    table->classes[(unsigned char)' '] = CLASS_BLANK;
+    table->classes[(unsigned char)'\t'] = CLASS_BLANK;
+    table->classes[(unsigned char)'\r'] = CLASS_BLANK;
+    table->classes[(unsigned char)'\n'] = CLASS_BLANK;
+    table->classes[(unsigned char)enclosure] = CLASS_ENCLOSURE;
+    table->classes[(unsigned char)delimiter] = delimiter == enclosure ? CLASS_DELIMITER_ENCLOSURE : CLASS_DELIMITER;
+
+    memcpy(table->transitions, base_transitions, sizeof(table->transitions));
+    /* After a closing quote only blanks may precede the delimiter, and the enclosure may itself be one. */
+    if (is_blank_byte(enclosure)) {
+        table->transitions[FIELD_END][CLASS_ENCLOSURE] = TRANSITION(FIELD_END, ACTION_NONE);
+    }
+
+    for (unsigned int state = 0; state < CSV_PARSE_STATE_COUNT; state++) {
+        table->stay[state] = 0;
+        for (unsigned int class = 0; class < CSV_PARSE_CLASS_COUNT; class++) {
+            if (table->transitions[state][class] == TRANSITION(state, ACTION_NONE)) {
+                table->stay[state] |= (uint8_t)(1u << class);
+            }
+        }
+    }
+
+    table->delimiter = delimiter;
+    table->enclosure = enclosure;
+}
+
+static const char* split_line_table(const char *line, size_t len, const CSVParseTable *table, FieldSink *sink,
+                                    int *error_column) {
+    unsigned int state = FIELD_START;
+    size_t field_start = 0;
+    size_t quote_end = 0;
+    size_t pos = 0;
+
+    for (; pos < len && sink->pending > 0; pos++) {
+        const unsigned int stay = table->stay[state];
+        while ((stay >> table->classes[(unsigned char)line[pos]]) & 1) {
+            if (++pos == len) {
+                goto done;
+            }
+        }
+
+        uint8_t transition = table->transitions[state][table->classes[(unsigned char)line[pos]]];
+        state = transition & 7;
+
+        switch (transition >> 3) {
+            case ACTION_NONE:
+                break;
+
+            case ACTION_OPEN_UNQUOTED:
+                field_start = pos;
+                break;
+
+            case ACTION_OPEN_QUOTED:
+                field_start = pos + 1;
+                break;
+
+            case ACTION_CLOSE_QUOTE:
+                quote_end = pos;
+                break;
+
+            case ACTION_EMIT_EMPTY:
+                if (!sink_field(sink, "", 0, false)) {
+                    *error_column = pos;
+                    return "Memory allocation failed";
+                }
+                field_start = pos + 1;
+                break;
+
+            case ACTION_EMIT_UNQUOTED:
+                if (!sink_field(sink, line + field_start, pos - field_start, false)) {
+                    *error_column = pos;
+                    return "Memory allocation failed";
+                }
+                field_start = pos + 1;
+                break;
+
+            case ACTION_EMIT_QUOTED:
+                if (!sink_field(sink, line + field_start, quote_end - field_start, true)) {
+                    *error_column = pos;
+                    return "Memory allocation failed";
+                }
+                field_start = pos + 1;
+                break;
+
+            default:
+                *error_column = pos;
+                return "Expected delimiter after quoted field";
+        }
+    }
+
+done:
+    if (sink->pending == 0) {
+        return NULL;
+    }
+
+    bool emitted = true;
+    switch (state) {
+        case QUOTED_FIELD:
+            *error_column = pos;
+            return "Unclosed quote";
+
+        case QUOTE_IN_QUOTED_FIELD:
+        case FIELD_END:
+            /* The trailing field is dropped when it is an empty quoted one. */
+            if (quote_end > field_start) {
+                emitted = sink_field(sink, line + field_start, quote_end - field_start, true);
+            }
+            break;
+
+        default:
+            emitted = sink_field(sink, line + field_start, len - field_start, false);
+            break;
+    }
+
+    return emitted ? NULL : "Memory allocation failed";
+}
+
+/* Every projected slot starts out empty so short lines still fill the record. */
+static void reset_projection(FieldSink *sink) {
+    const CSVProjection *projection = sink->projection;
+    sink->column = 0;
+    sink->pending = projection ? projection->output_count : (size_t)-1;
+    if (!projection) {
+        return;
+    }
+
+    for (size_t i = 0; i < projection->output_count; i++) {
+        if (sink->views) {
+            set_view(&sink->views->fields[i], sink->empty, 0, false, sink->enclosure);
         } else {
-            field[write_pos++] = start[i];
+            sink->strings->fields[i] = sink->empty;
+        }
+    }
+}
+
+/* For a line with no enclosure byte every field is the verbatim span between delimiters. */
+static const char* split_line_unquoted(const char *line, size_t len, char delimiter, FieldSink *sink) {
+    const char *start = line;
+    const char *end = line + len;
+
+    while (sink->pending > 0) {
+        const char *next = memchr(start, delimiter, (size_t)(end - start));
+        if (!next) {
+            return sink_field(sink, start, (size_t)(end - start), false) ? NULL : "Memory allocation failed";
+        }
+        if (!sink_field(sink, start, (size_t)(next - start), false)) {
+            return "Memory allocation failed";
+        }
+        start = next + 1;
+    }
+    return NULL;
+}
+
+static const char* split_line(const char *line, size_t len, const CSVConfig *config, FieldSink *sink, int *error_column) {
+    if (sink->unquoted) {
+        return split_line_unquoted(line, len, config->delimiter, sink);
+    }
+    if (csv_simd_get_level() != CSV_SIMD_DISABLED &&
+        config->delimiter != '\0' && config->enclosure != '\0' && config->delimiter != config->enclosure) {
+        FieldArray strings;
+        FieldViewArray views;
+        if (sink->strings) strings = *sink->strings;
+        if (sink->views) views = *sink->views;
+        ArenaRegion region = arena_begin_region(sink->arena);
+
+        SplitStatus status = split_line_indexed(line, len, config, sink);
+        if (status == SPLIT_OK) {
+            return NULL;
+        }
+        if (status == SPLIT_NO_MEMORY) {
+            return "Memory allocation failed";
+        }
+
+        arena_restore_region(&region);
+        if (sink->strings) *sink->strings = strings;
+        if (sink->views) *sink->views = views;
+        reset_projection(sink);
+    }
+
+    if (sink->table) {
+        return split_line_table(line, len, sink->table, sink, error_column);
+    }
+    CSVParseTable table;
+    csv_parse_table_build(&table, config);
+    return split_line_table(line, len, &table, sink, error_column);
+}
+
+static bool is_blank_span(const char *start, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (start[i] != ' ' && start[i] != '\t') {
+            return false;
         }
     }
-    
-    field[write_pos] = '\0';
-    arr->fields[arr->count++] = field;
     return true;
 }
 
+static CSVScanStatus end_record(const char *data, size_t available, bool at_end, size_t pos, CSVRecordExtent *extent) {
+    size_t next = pos + 1;
+    if (pos == available) {
+        next = pos;
+    } else if (data[pos] == '\r') {
+        if (next == available && !at_end) {
+            return CSV_SCAN_INCOMPLETE;
+        }
+        if (next < available && data[next] == '\n') {
+            next++;
+        }
+    }
+
+    extent->length = pos;
+    extent->consumed = next;
+    return CSV_SCAN_COMPLETE;
+}
+
+/*
+ * Walks the structural bits of csv_simd_index_block from the start of the
+ * record, emitting fields at delimiters and stopping at the first newline
+ * outside quotes, so each byte is classified once. Framing toggles on any
+ * enclosure while split_line_table only honours quotes that open a field;
+ * the two agree on regular quoting, and anything else (a quote inside an
+ * unquoted field, text after a closing quote, an unclosed quote) is
+ * reported as irregular. Once a projection has every column it needs the
+ * rest of the record is only framed.
+ */
+static CSVScanStatus scan_record(const char *data, size_t available, bool at_end, const CSVConfig *config,
+                                 FieldSink *sink, CSVRecordExtent *extent) {
+    const char delimiter = config->delimiter;
+    const char enclosure = config->enclosure;
+    char tail[CSV_SIMD_BLOCK_SIZE];
+    CSVStructuralMasks masks;
+    ScanState state = SCAN_FIELD;
+    bool in_quotes = false;
+    size_t field_start = 0;
+    size_t quote_end = 0;
+    size_t skip_until = 0;
+
+    for (size_t base = 0; base < available; base += CSV_SIMD_BLOCK_SIZE) {
+        const char *block = data + base;
+        size_t remaining = available - base;
+        uint64_t valid = ~(uint64_t)0;
+
+        if (remaining < CSV_SIMD_BLOCK_SIZE) {
+            memset(tail, 0, sizeof(tail));
+            memcpy(tail, block, remaining);
+            block = tail;
+            valid = ((uint64_t)1 << remaining) - 1;
+        }
+
+        csv_simd_index_block(block, delimiter, enclosure, &masks);
+        uint64_t bits = (masks.delimiter | masks.enclosure | masks.newline) & valid;
+
+        while (bits) {
+            size_t pos = base + (size_t)__builtin_ctzll(bits);
+            bits &= bits - 1;
+            char c = data[pos];
+
+            switch (state) {
+                case SCAN_FIELD:
+                    if (c == enclosure) {
+                        if (pos != field_start) {
+                            return CSV_SCAN_IRREGULAR;
+                        }
+                        state = SCAN_QUOTED;
+                        break;
+                    }
+                    if (!sink_field(sink, data + field_start, pos - field_start, false)) {
+                        return CSV_SCAN_IRREGULAR;
+                    }
+                    if (c != delimiter) {
+                        return end_record(data, available, at_end, pos, extent);
+                    }
+                    field_start = pos + 1;
+                    if (sink->pending == 0) {
+                        state = SCAN_SKIP;
+                    }
+                    break;
+
+                case SCAN_QUOTED:
+                    if (c != enclosure || pos < skip_until) {
+                        break;
+                    }
+                    if (pos + 1 == available && !at_end) {
+                        return CSV_SCAN_INCOMPLETE;
+                    }
+                    if (pos + 1 < available && data[pos + 1] == enclosure) {
+                        skip_until = pos + 2;
+                        break;
+                    }
+                    quote_end = pos;
+                    state = SCAN_CLOSED;
+                    break;
+
+                case SCAN_CLOSED: {
+                    if (c == enclosure || !is_blank_span(data + quote_end + 1, pos - quote_end - 1)) {
+                        return CSV_SCAN_IRREGULAR;
+                    }
+                    size_t len = quote_end - field_start - 1;
+                    if (c != delimiter) {
+                        /* The state machine drops a trailing empty quoted field; keep parity. */
+                        if (len > 0 && !sink_field(sink, data + field_start + 1, len, true)) {
+                            return CSV_SCAN_IRREGULAR;
+                        }
+                        return end_record(data, available, at_end, pos, extent);
+                    }
+                    if (!sink_field(sink, data + field_start + 1, len, true)) {
+                        return CSV_SCAN_IRREGULAR;
+                    }
+                    field_start = pos + 1;
+                    state = sink->pending == 0 ? SCAN_SKIP : SCAN_FIELD;
+                    break;
+                }
+
+                case SCAN_SKIP:
+                    if (c == enclosure) {
+                        in_quotes = !in_quotes;
+                    } else if (c != delimiter && !in_quotes) {
+                        return end_record(data, available, at_end, pos, extent);
+                    }
+                    break;
+            }
+        }
+    }
+
+    if (!at_end) {
+        return CSV_SCAN_INCOMPLETE;
+    }
+
+    switch (state) {
+        case SCAN_FIELD:
+            if (!sink_field(sink, data + field_start, available - field_start, false)) {
+                return CSV_SCAN_IRREGULAR;
+            }
+            break;
+
+        case SCAN_QUOTED:
+            return CSV_SCAN_IRREGULAR;
+
+        case SCAN_CLOSED: {
+            if (!is_blank_span(data + quote_end + 1, available - quote_end - 1)) {
+                return CSV_SCAN_IRREGULAR;
+            }
+            size_t len = quote_end - field_start - 1;
+            if (len > 0 && !sink_field(sink, data + field_start + 1, len, true)) {
+                return CSV_SCAN_IRREGULAR;
+            }
+            break;
+        }
+
+        case SCAN_SKIP:
+            break;
+    }
+    return end_record(data, available, at_end, available, extent);
+}
+
+static bool can_scan(const CSVConfig *config) {
+    const char delimiter = config->delimiter;
+    const char enclosure = config->enclosure;
+    return delimiter != '\0' && enclosure != '\0' && delimiter != enclosure &&
+           delimiter != '\n' && delimiter != '\r' && enclosure != '\n' && enclosure != '\r';
+}
+
+/*
+ * Frames and splits a record assuming nothing in it is quoted, so there is
+ * no quote state: every delimiter ends a field and the first newline ends
+ * the record. The first enclosure byte stops the scan as irregular, leaving
+ * the record to the full scanner.
+ */
+static CSVScanStatus scan_unquoted(const char *data, size_t available, bool at_end, char delimiter, char enclosure,
+                                   FieldSink *sink, CSVRecordExtent *extent) {
+    char tail[CSV_SIMD_BLOCK_SIZE];
+    CSVStructuralMasks masks;
+    size_t field_start = 0;
+
+    for (size_t base = 0; base < available; base += CSV_SIMD_BLOCK_SIZE) {
+        const char *block = data + base;
+        size_t remaining = available - base;
+        uint64_t valid = ~(uint64_t)0;
+
+        if (remaining < CSV_SIMD_BLOCK_SIZE) {
+            memset(tail, 0, sizeof(tail));
+            memcpy(tail, block, remaining);
+            block = tail;
+            valid = ((uint64_t)1 << remaining) - 1;
+        }
+
+        csv_simd_index_block(block, delimiter, enclosure, &masks);
+        uint64_t bits = (masks.delimiter | masks.enclosure | masks.newline) & valid;
+
+        while (bits) {
+            size_t pos = base + (size_t)__builtin_ctzll(bits);
+            bits &= bits - 1;
+            char c = data[pos];
+
+            if (c == enclosure) {
+                return CSV_SCAN_IRREGULAR;
+            }
+            if (sink->pending > 0 && !sink_field(sink, data + field_start, pos - field_start, false)) {
+                return CSV_SCAN_IRREGULAR;
+            }
+            if (c != delimiter) {
+                return end_record(data, available, at_end, pos, extent);
+            }
+            field_start = pos + 1;
+        }
+    }
+
+    if (!at_end) {
+        return CSV_SCAN_INCOMPLETE;
+    }
+    if (sink->pending > 0 && !sink_field(sink, data + field_start, available - field_start, false)) {
+        return CSV_SCAN_IRREGULAR;
+    }
+    return end_record(data, available, at_end, available, extent);
+}
+
 CSVParseResult csv_parse_line_inplace(const char *line, Arena *arena, const CSVConfig *config, int line_number) {
+    return csv_parse_record(line, line ? strlen(line) : 0, arena, config, line_number);
+}
+
+static bool init_sink(FieldSink *sink, FieldArray *strings, FieldViewArray *views, Arena *arena,
+                      const CSVConfig *config, const CSVProjection *projection) {
+    sink->strings = strings;
+    sink->views = views;
+    sink->arena = arena;
+    sink->enclosure = config->enclosure;
+    sink->projection = projection && projection->output_count > 0 ? projection : NULL;
+    sink->table = NULL;
+    sink->unquoted = false;
+    sink->empty = NULL;
+
+    if (sink->projection) {
+        void *ptr;
+        if (arena_alloc(arena, 1, &ptr) != ARENA_OK) {
+            return false;
+        }
+        sink->empty = (char*)ptr;
+        sink->empty[0] = '\0';
+        if (strings) strings->count = sink->projection->output_count;
+        if (views) views->count = sink->projection->output_count;
+    }
+    reset_projection(sink);
+    return true;
+}
+
+static size_t initial_field_capacity(const CSVProjection *projection) {
+    if (projection && projection->output_count > 0) {
+        return projection->output_count;
+    }
+    return 16;
+}
+
+CSVParseResult csv_parse_record(const char *line, size_t length, Arena *arena, const CSVConfig *config, int line_number) {
+    return csv_parse_record_projected(line, length, arena, config, line_number, NULL);
+}
+
+static CSVParseResult parse_record(const char *line, size_t length, Arena *arena, const CSVConfig *config,
+                                   int line_number, const CSVProjection *projection, const CSVParseTable *table,
+                                   bool unquoted) {
     CSVParseResult result = {0};
     result.success = true;
     result.error = NULL;
@@ -99,156 +863,303 @@ CSVParseResult csv_parse_line_inplace(const char *line, Arena *arena, const CSVC
         return result;
     }
 
-    init_field_array(&result.fields, arena, 16);
+    init_field_array(&result.fields, arena, initial_field_capacity(projection));
     if (!result.fields.fields) {
         result.success = false;
         result.error = "Failed to allocate field array";
         return result;
     }
 
-    size_t len = strlen(line);
-    ParseState state = FIELD_START;
-    const char *field_start = line;
-    size_t field_len = 0;
-    size_t pos = 0;
-
-    while (pos < len) {
-        char c = line[pos];
-        
-        switch (state) {
-            case FIELD_START:
-                if (c == config->enclosure) {
-                    state = QUOTED_FIELD;
-                    field_start = &line[pos + 1];
-                    field_len = 0;
-                } else if (c == config->delimiter) {
-                    if (!add_field(&result.fields, "", 0, arena)) {
-                        result.success = false;
-                        result.error = "Memory allocation failed";
-                        result.error_column = pos;
-                        return result;
-                    }
-                    field_start = &line[pos + 1];
-                    field_len = 0;
-                } else {
-                    state = UNQUOTED_FIELD;
-                    field_start = &line[pos];
-                    field_len = 1;
-                }
-                break;
+    FieldSink sink;
+    if (!init_sink(&sink, &result.fields, NULL, arena, config, projection)) {
+        result.success = false;
+        result.error = "Memory allocation failed";
+        return result;
+    }
+    sink.table = table;
+    sink.unquoted = unquoted;
+    result.error = split_line(line, length, config, &sink, &result.error_column);
+    result.success = result.error == NULL;
+    return result;
+}
 
-            case UNQUOTED_FIELD:
-                if (c == config->delimiter) {
-                    if (!add_field(&result.fields, field_start, field_len, arena)) {
-                        result.success = false;
-                        result.error = "Memory allocation failed";
-                        result.error_column = pos;
-                        return result;
-                    }
-                    state = FIELD_START;
-                    field_start = &line[pos + 1];
-                    field_len = 0;
-                } else {
-                    field_len++;
-                }
-                break;
+CSVParseViewResult csv_parse_line_views(const char *line, size_t length, Arena *arena, const CSVConfig *config, int line_number) {
+    return csv_parse_line_views_projected(line, length, arena, config, line_number, NULL);
+}
 
-            case QUOTED_FIELD:
-                if (c == config->enclosure) {
-                    if (pos + 1 < len && line[pos + 1] == config->enclosure) {
-                        field_len += 2;
-                        pos++;
-                    } else {
-                        state = FIELD_END;
-                    }
-                } else {
-                    field_len++;
-                }
-                break;
+static CSVParseViewResult parse_views(const char *line, size_t length, Arena *arena, const CSVConfig *config,
+                                      int line_number, const CSVProjection *projection, const CSVParseTable *table,
+                                      bool unquoted) {
+    CSVParseViewResult result = {0};
+    result.success = true;
+    result.error = NULL;
+    result.error_line = line_number;
+    result.error_column = 0;
 
-            case FIELD_END:
-                if (c == config->delimiter) {
-                    if (!add_quoted_field(&result.fields, field_start, field_len, arena, config->enclosure)) {
-                        result.success = false;
-                        result.error = "Memory allocation failed";
-                        result.error_column = pos;
-                        return result;
-                    }
-                    state = FIELD_START;
-                    field_start = &line[pos + 1];
-                    field_len = 0;
-                } else if (c != ' ' && c != '\t' && c != '\r' && c != '\n') {
-                    result.success = false;
-                    result.error = "Expected delimiter after quoted field";
-                    result.error_column = pos;
-                    return result;
-                }
-                break;
+    if (!line || !arena || !config) {
+        result.success = false;
+        result.error = "Invalid arguments";
+        return result;
+    }
 
-            default:
-                result.success = false;
-                result.error = "Invalid parser state";
-                result.error_column = pos;
-                return result;
-        }
-        pos++;
+    init_view_array(&result.fields, arena, initial_field_capacity(projection));
+    if (!result.fields.fields) {
+        result.success = false;
+        result.error = "Failed to allocate field array";
+        return result;
     }
 
-    if (state == QUOTED_FIELD) {
+    FieldSink sink;
+    if (!init_sink(&sink, NULL, &result.fields, arena, config, projection)) {
         result.success = false;
-        result.error = "Unclosed quote";
-        result.error_column = pos;
+        result.error = "Memory allocation failed";
         return result;
     }
+    sink.table = table;
+    sink.unquoted = unquoted;
+    result.error = split_line(line, length, config, &sink, &result.error_column);
+    result.success = result.error == NULL;
+    return result;
+}
 
-    if (field_len > 0 || state == FIELD_START) {
-        if (state == FIELD_END) {
-            if (!add_quoted_field(&result.fields, field_start, field_len, arena, config->enclosure)) {
-                result.success = false;
-                result.error = "Memory allocation failed";
-                return result;
-            }
-        } else {
-            if (!add_field(&result.fields, field_start, field_len, arena)) {
-                result.success = false;
-                result.error = "Memory allocation failed";
-                return result;
-            }
-        }
+CSVParseResult csv_parse_record_projected(const char *line, size_t length, Arena *arena, const CSVConfig *config,
+                                          int line_number, const CSVProjection *projection) {
+    return parse_record(line, length, arena, config, line_number, projection, NULL, false);
+}
+
+CSVParseViewResult csv_parse_line_views_projected(const char *line, size_t length, Arena *arena, const CSVConfig *config,
+                                                  int line_number, const CSVProjection *projection) {
+    return parse_views(line, length, arena, config, line_number, projection, NULL, false);
+}
+
+CSVParser* csv_parser_init(Arena *arena, CSVConfig *config) {
+    if (!arena || !config) {
+        return NULL;
     }
 
+    void *ptr;
+    if (arena_alloc(arena, sizeof(CSVParser), &ptr) != ARENA_OK) {
+        return NULL;
+    }
+
+    CSVParser *parser = (CSVParser*)ptr;
+    memset(parser, 0, sizeof(CSVParser));
+    parser->config = config;
+    parser->arena = arena;
+    parser->parse_ctx.state = FIELD_START;
+    parser->parse_ctx.delimiter = config->delimiter;
+    parser->parse_ctx.enclosure = config->enclosure;
+    parser->parse_ctx.escape = config->escape;
+    parser->parse_ctx.arena = arena;
+    csv_parse_table_build(&parser->table, config);
+    return parser;
+}
+
+void csv_parser_free(CSVParser *parser) {
+    (void)parser;
+}
+
+static const CSVParseTable* parser_table(CSVParser *parser) {
+    if (parser->table.delimiter != parser->config->delimiter || parser->table.enclosure != parser->config->enclosure) {
+        csv_parse_table_build(&parser->table, parser->config);
+    }
+    return &parser->table;
+}
+
+/* The unquoted fast path ends for good at the first line holding an enclosure. */
+static bool parser_unquoted(CSVParser *parser, const char *line, size_t length) {
+    if (parser->unquoted && line && memchr(line, parser->config->enclosure, length)) {
+        parser->unquoted = false;
+    }
+    return parser->unquoted;
+}
+
+CSVParseResult csv_parser_parse_record(CSVParser *parser, const char *line, size_t length, Arena *arena,
+                                       int line_number, const CSVProjection *projection) {
+    if (!parser || !parser->config) {
+        return parse_record(line, length, arena, NULL, line_number, projection, NULL, false);
+    }
+    return parse_record(line, length, arena, parser->config, line_number, projection, parser_table(parser),
+                        parser_unquoted(parser, line, length));
+}
+
+CSVParseViewResult csv_parser_parse_views(CSVParser *parser, const char *line, size_t length, Arena *arena,
+                                          int line_number, const CSVProjection *projection) {
+    if (!parser || !parser->config) {
+        return parse_views(line, length, arena, NULL, line_number, projection, NULL, false);
+    }
+    return parse_views(line, length, arena, parser->config, line_number, projection, parser_table(parser),
+                       parser_unquoted(parser, line, length));
+}
+
+static CSVParseResult scan_into_record(const char *data, size_t available, bool at_end, Arena *arena,
+                                       const CSVConfig *config, bool unquoted, int line_number,
+                                       const CSVProjection *projection, CSVRecordExtent *extent) {
+    CSVParseResult result = {0};
+    result.error_line = line_number;
+    if (!extent) {
+        return result;
+    }
+    extent->status = CSV_SCAN_IRREGULAR;
+
+    if (!data || !arena || !config || !can_scan(config)) {
+        return result;
+    }
+
+    init_field_array(&result.fields, arena, initial_field_capacity(projection));
+    FieldSink sink;
+    if (!result.fields.fields || !init_sink(&sink, &result.fields, NULL, arena, config, projection)) {
+        return result;
+    }
+    if (unquoted) {
+        extent->status = scan_unquoted(data, available, at_end, config->delimiter, config->enclosure, &sink, extent);
+    } else {
+        extent->status = scan_record(data, available, at_end, config, &sink, extent);
+    }
+    result.success = extent->status == CSV_SCAN_COMPLETE;
     return result;
 }
 
+static CSVParseViewResult scan_into_views(const char *data, size_t available, bool at_end, Arena *arena,
+                                          const CSVConfig *config, bool unquoted, int line_number,
+                                          const CSVProjection *projection, CSVRecordExtent *extent) {
+    CSVParseViewResult result = {0};
+    result.error_line = line_number;
+    if (!extent) {
+        return result;
+    }
+    extent->status = CSV_SCAN_IRREGULAR;
+
+    if (!data || !arena || !config || !can_scan(config)) {
+        return result;
+    }
+
+    init_view_array(&result.fields, arena, initial_field_capacity(projection));
+    FieldSink sink;
+    if (!result.fields.fields || !init_sink(&sink, NULL, &result.fields, arena, config, projection)) {
+        return result;
+    }
+    if (unquoted) {
+        extent->status = scan_unquoted(data, available, at_end, config->delimiter, config->enclosure, &sink, extent);
+    } else {
+        extent->status = scan_record(data, available, at_end, config, &sink, extent);
+    }
+    result.success = extent->status == CSV_SCAN_COMPLETE;
+    return result;
+}
+
+CSVParseResult csv_scan_record_projected(const char *data, size_t available, bool at_end, Arena *arena,
+                                         const CSVConfig *config, int line_number, const CSVProjection *projection,
+                                         CSVRecordExtent *extent) {
+    return scan_into_record(data, available, at_end, arena, config, false, line_number,
+                            projection, extent);
+}
+
+CSVParseViewResult csv_scan_record_views_projected(const char *data, size_t available, bool at_end, Arena *arena,
+                                                   const CSVConfig *config, int line_number,
+                                                   const CSVProjection *projection, CSVRecordExtent *extent) {
+    return scan_into_views(data, available, at_end, arena, config, false, line_number,
+                           projection, extent);
+}
+
+CSVParseResult csv_parser_scan_record(CSVParser *parser, const char *data, size_t available, bool at_end,
+                                      Arena *arena, int line_number, const CSVProjection *projection,
+                                      CSVRecordExtent *extent) {
+    if (!parser || !parser->config) {
+        return scan_into_record(data, available, at_end, arena, NULL, false, line_number,
+                                projection, extent);
+    }
+
+    if (parser->unquoted && can_scan(parser->config)) {
+        CSVParseResult result = scan_into_record(data, available, at_end, arena, parser->config, true,
+                                                 line_number, projection, extent);
+        if (!extent || extent->status != CSV_SCAN_IRREGULAR) {
+            return result;
+        }
+        parser->unquoted = false;
+    }
+    return scan_into_record(data, available, at_end, arena, parser->config, false, line_number,
+                            projection, extent);
+}
+
+CSVParseViewResult csv_parser_scan_views(CSVParser *parser, const char *data, size_t available, bool at_end,
+                                         Arena *arena, int line_number, const CSVProjection *projection,
+                                         CSVRecordExtent *extent) {
+    if (!parser || !parser->config) {
+        return scan_into_views(data, available, at_end, arena, NULL, false, line_number,
+                               projection, extent);
+    }
+
+    if (parser->unquoted && can_scan(parser->config)) {
+        CSVParseViewResult result = scan_into_views(data, available, at_end, arena, parser->config, true,
+                                                    line_number, projection, extent);
+        if (!extent || extent->status != CSV_SCAN_IRREGULAR) {
+            return result;
+        }
+        parser->unquoted = false;
+    }
+    return scan_into_views(data, available, at_end, arena, parser->config, false, line_number,
+                           projection, extent);
+}
+
+char* csv_field_view_to_string(const CSVFieldView *view, char enclosure, Arena *arena) {
+    if (!view || !arena) {
+        return NULL;
+    }
+
+    void *ptr;
+    ArenaResult result = arena_alloc(arena, view->length + 1, &ptr);
+    if (result != ARENA_OK) {
+        return NULL;
+    }
+
+    char *field = (char*)ptr;
+    size_t length = view->length;
+    if (view->needs_unescape) {
+        length = unescape_into(field, view->data, view->length, enclosure);
+    } else if (length > 0) {
+        memcpy(field, view->data, length);
+    }
+    field[length] = '\0';
+    return field;
+}
+
+size_t csv_field_view_copy(const CSVFieldView *view, char enclosure, char *dest) {
+    if (!view || !dest) {
+        return 0;
+    }
+
+    if (view->needs_unescape) {
+        return unescape_into(dest, view->data, view->length, enclosure);
+    }
+    if (view->length > 0) {
+        memcpy(dest, view->data, view->length);
+    }
+    return view->length;
+}
+
 char* read_full_record(FILE *file, Arena *arena) {
     if (!file || !arena) {
         return NULL;
     }
 
-    size_t record_capacity = 1024;
-    void *arena_ptr;
-    ArenaResult result = arena_alloc(arena, record_capacity, &arena_ptr);
-    if (result != ARENA_OK) {
+    /* Builds the record in a reservation so growth never copies within a block. */
+    size_t record_capacity;
+    char *record = arena_reserve(arena, 1024, &record_capacity);
+    if (!record) {
         return NULL;
     }
     
-    char *record = (char*)arena_ptr;
     size_t record_len = 0;
     bool in_quotes = false;
     int c;
 
     while ((c = fgetc(file)) != EOF) {
-        if (record_len >= record_capacity - 1) {
-            size_t new_capacity = record_capacity * 2;
-            void *new_ptr;
-            ArenaResult grow_result = arena_alloc(arena, new_capacity, &new_ptr);
-            if (grow_result != ARENA_OK) {
+        if (record_len + 3 > record_capacity) {
+            record = arena_grow_reservation(arena, record, record_len, record_capacity * 2, &record_capacity);
+            if (!record) {
                 return NULL;
             }
-            char *new_record = (char*)new_ptr;
-            memcpy(new_record, record, record_len);
-            record = new_record;
-            record_capacity = new_capacity;
         }
 
         if (c == '"') {
@@ -290,6 +1201,9 @@ char* read_full_record(FILE *file, Arena *arena) {
     }
 
     record[record_len] = '\0';
+    if (arena_commit(arena, record, record_len + 1) != ARENA_OK) {
+        return NULL;
+    }
     
     return record;
 } 
\ No newline at end of file
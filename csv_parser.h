@@ -4,6 +4,7 @@
 #include "csv_config.h"
 #include "arena.h"
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdbool.h>
 
@@ -17,6 +18,24 @@ typedef enum {
     FIELD_END
 } ParseState;
 
+#define CSV_PARSE_STATE_COUNT 5
+#define CSV_PARSE_CLASS_COUNT 5
+
+/*
+ * Field splitting state machine compiled for one dialect: each byte maps to
+ * a class, and each state/class pair to the next state plus the action to
+ * run, so the inner loop is a lookup per byte. stay[state] has a bit for
+ * each class that loops on the state with no action; runs of those bytes
+ * are skipped on the class lookup alone.
+ */
+typedef struct {
+    uint8_t classes[256];
+    uint8_t transitions[CSV_PARSE_STATE_COUNT][CSV_PARSE_CLASS_COUNT];
+    uint8_t stay[CSV_PARSE_STATE_COUNT];
+    char delimiter;
+    char enclosure;
+} CSVParseTable;
+
 typedef enum {
     CSV_PARSER_OK = 0,
     CSV_PARSER_ERROR_NULL_POINTER,
@@ -32,6 +51,42 @@ typedef struct {
     size_t capacity;
 } FieldArray;
 
+typedef struct {
+    const char *data;
+    size_t length;
+    bool needs_unescape;
+} CSVFieldView;
+
+typedef struct {
+    CSVFieldView *fields;
+    size_t count;
+    size_t capacity;
+} FieldViewArray;
+
+/*
+ * Maps source columns to output positions: slots[column] is the index the
+ * field lands at in the parsed record, or -1 to skip it. Records always have
+ * output_count fields; columns missing from a short line come back empty.
+ */
+typedef struct {
+    int *slots;
+    size_t column_count;
+    size_t output_count;
+} CSVProjection;
+
+typedef enum {
+    CSV_SCAN_COMPLETE,
+    CSV_SCAN_INCOMPLETE,
+    CSV_SCAN_IRREGULAR
+} CSVScanStatus;
+
+/* Where a scanned record ends: length excludes the terminator, consumed includes it. */
+typedef struct {
+    CSVScanStatus status;
+    size_t length;
+    size_t consumed;
+} CSVRecordExtent;
+
 typedef struct {
     char *line;
     size_t pos;
@@ -53,10 +108,20 @@ typedef struct {
     int error_column;
 } CSVParseResult;
 
+typedef struct {
+    FieldViewArray fields;
+    bool success;
+    const char *error;
+    int error_line;
+    int error_column;
+} CSVParseViewResult;
+
 typedef struct {
     CSVConfig *config;
     Arena *arena;
     ParseContext parse_ctx;
+    CSVParseTable table;
+    bool unquoted;
 } CSVParser;
 
 char* read_full_record(FILE *file, Arena *arena);
@@ -66,8 +131,54 @@ int parse_headers(const char *line, char **fields, int max_fields, Arena *arena,
 CSVParserResult csv_parser_count_fields_in_line(const char *line, const ParseContext *ctx, int *field_count);
 CSVParserResult csv_parser_split_line_generic(const char *line, FieldArray *fields, const ParseContext *ctx);
 
+void csv_parse_table_build(CSVParseTable *table, const CSVConfig *config);
+
+/*
+ * A parser is allocated from arena and keeps the table for its config,
+ * recompiling it if the delimiter or enclosure change. The free parse
+ * functions compile a table on the stack when they need one.
+ *
+ * Setting unquoted skips quote tracking: fields are split at delimiters
+ * with memchr or the SIMD index alone. The first record holding the
+ * enclosure clears it and is parsed, like every later one, by the full
+ * state machine, so the output never differs.
+ */
 CSVParser* csv_parser_init(Arena *arena, CSVConfig *config);
 void csv_parser_free(CSVParser *parser);
+CSVParseResult csv_parser_parse_record(CSVParser *parser, const char *line, size_t length, Arena *arena,
+                                       int line_number, const CSVProjection *projection);
+CSVParseViewResult csv_parser_parse_views(CSVParser *parser, const char *line, size_t length, Arena *arena,
+                                          int line_number, const CSVProjection *projection);
 CSVParseResult csv_parse_line_inplace(const char *line, Arena *arena, const CSVConfig *config, int line_number);
+CSVParseResult csv_parse_record(const char *line, size_t length, Arena *arena, const CSVConfig *config, int line_number);
+CSVParseViewResult csv_parse_line_views(const char *line, size_t length, Arena *arena, const CSVConfig *config, int line_number);
+CSVParseResult csv_parse_record_projected(const char *line, size_t length, Arena *arena, const CSVConfig *config,
+                                          int line_number, const CSVProjection *projection);
+CSVParseViewResult csv_parse_line_views_projected(const char *line, size_t length, Arena *arena, const CSVConfig *config,
+                                                  int line_number, const CSVProjection *projection);
+
+/*
+ * Split the record at the start of data and find its terminator in the same
+ * pass, framing records exactly like csv_buffer_next_record. at_end says no
+ * more input follows data. The fields are only valid when extent->status
+ * is CSV_SCAN_COMPLETE; INCOMPLETE means the record runs past data, and
+ * IRREGULAR means its quoting (or a failure) needs the two-pass path.
+ */
+CSVParseResult csv_scan_record_projected(const char *data, size_t available, bool at_end, Arena *arena,
+                                         const CSVConfig *config, int line_number, const CSVProjection *projection,
+                                         CSVRecordExtent *extent);
+CSVParseViewResult csv_scan_record_views_projected(const char *data, size_t available, bool at_end, Arena *arena,
+                                                   const CSVConfig *config, int line_number,
+                                                   const CSVProjection *projection, CSVRecordExtent *extent);
+CSVParseResult csv_parser_scan_record(CSVParser *parser, const char *data, size_t available, bool at_end,
+                                      Arena *arena, int line_number, const CSVProjection *projection,
+                                      CSVRecordExtent *extent);
+CSVParseViewResult csv_parser_scan_views(CSVParser *parser, const char *data, size_t available, bool at_end,
+                                         Arena *arena, int line_number, const CSVProjection *projection,
+                                         CSVRecordExtent *extent);
+char* csv_field_view_to_string(const CSVFieldView *view, char enclosure, Arena *arena);
+
+/* Unescapes view into dest, which needs view->length bytes; returns the bytes written. */
+size_t csv_field_view_copy(const CSVFieldView *view, char enclosure, char *dest);
 
 #endif 
@@ -0,0 +1,222 @@
+#include "csv_push.h"
+#include "csv_parser.h"
+#include "arena.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define CSV_PUSH_RECORD_ARENA_SIZE (64 * 1024)
+
+struct CSVPushParser {
+    const CSVConfig *config;
+    CSVPushRecordCallback callback;
+    void *user_data;
+    Arena arena;
+    char *pending;
+    size_t pending_length;
+    size_t pending_capacity;
+    bool in_quotes;
+    bool skip_newline;
+    int line_number;
+    CSVPushResult status;
+    const char *error;
+    int error_line;
+    int error_column;
+};
+
+const char* csv_push_error_string(CSVPushResult result) {
+    switch (result) {
+        case CSV_PUSH_OK: return "Success";
+        case CSV_PUSH_STOPPED: return "Stopped by callback";
+        case CSV_PUSH_ERROR_NULL_POINTER: return "Null pointer error";
+        case CSV_PUSH_ERROR_MEMORY_ALLOCATION: return "Memory allocation failed";
+        case CSV_PUSH_ERROR_PARSE: return "Failed to parse record";
+        case CSV_PUSH_ERROR_FINISHED: return "Parser already finished";
+        default: return "Unknown error";
+    }
+}
+
+CSVPushParser* csv_push_parser_create(const CSVConfig *config, CSVPushRecordCallback callback, void *user_data) {
+    if (!config || !callback) {
+        return NULL;
+    }
+
+    CSVPushParser *parser = calloc(1, sizeof(CSVPushParser));
+    if (!parser) {
+        return NULL;
+    }
+    if (arena_create_growable(&parser->arena, CSV_PUSH_RECORD_ARENA_SIZE, 0) != ARENA_OK) {
+        free(parser);
+        return NULL;
+    }
+
+    parser->config = config;
+    parser->callback = callback;
+    parser->user_data = user_data;
+    parser->status = CSV_PUSH_OK;
+    return parser;
+}
+
+void csv_push_parser_free(CSVPushParser *parser) {
+    if (!parser) {
+        return;
+    }
+
+    arena_destroy(&parser->arena);
+    free(parser->pending);
+    free(parser);
+}
+
+const char* csv_push_parser_error(const CSVPushParser *parser, int *line, int *column) {
+    if (!parser || !parser->error) {
+        return NULL;
+    }
+
+    if (line) *line = parser->error_line;
+    if (column) *column = parser->error_column;
+    return parser->error;
+}
+
+/*
+ * Same rules as the buffered reader: an enclosure anywhere outside quotes
+ * opens a quoted run, and a doubled enclosure inside one toggles out and
+ * straight back in, so the state never needs to look past the chunk end.
+ */
+static const char* find_terminator(const char *p, const char *end, char enclosure, bool *in_quotes) {
+    while (p < end) {
+        if (*in_quotes) {
+            const char *q = memchr(p, enclosure, end - p);
+            if (!q) {
+                return NULL;
+            }
+            *in_quotes = false;
+            p = q + 1;
+            continue;
+        }
+
+        const char *nl = memchr(p, '\n', end - p);
+        const char *span_end = nl ? nl : end;
+        const char *q = memchr(p, enclosure, span_end - p);
+        const char *cr = memchr(p, '\r', (q ? q : span_end) - p);
+
+        if (cr) {
+            return cr;
+        }
+        if (q) {
+            *in_quotes = true;
+            p = q + 1;
+            continue;
+        }
+        return nl;
+    }
+    return NULL;
+}
+
+static bool append_pending(CSVPushParser *parser, const char *data, size_t length) {
+    size_t needed = parser->pending_length + length;
+    if (needed > parser->pending_capacity) {
+        size_t capacity = parser->pending_capacity ? parser->pending_capacity : 4096;
+        while (capacity < needed) {
+            capacity *= 2;
+        }
+        char *pending = realloc(parser->pending, capacity);
+        if (!pending) {
+            return false;
+        }
+        parser->pending = pending;
+        parser->pending_capacity = capacity;
+    }
+
+    memcpy(parser->pending + parser->pending_length, data, length);
+    parser->pending_length = needed;
+    return true;
+}
+
+static CSVPushResult emit_record(CSVPushParser *parser, const char *line, size_t length) {
+    parser->line_number++;
+    if (length == 0 && parser->config->skipEmptyLines) {
+        return CSV_PUSH_OK;
+    }
+
+    arena_reset(&parser->arena);
+    CSVParseResult result = csv_parse_record(line, length, &parser->arena, parser->config, parser->line_number);
+    if (!result.success) {
+        parser->error = result.error;
+        parser->error_line = result.error_line;
+        parser->error_column = result.error_column;
+        return CSV_PUSH_ERROR_PARSE;
+    }
+
+    CSVRecord record = { result.fields.fields, result.fields.count };
+    return parser->callback(&record, parser->line_number, parser->user_data) ? CSV_PUSH_OK : CSV_PUSH_STOPPED;
+}
+
+static CSVPushResult feed_records(CSVPushParser *parser, const char *p, const char *end) {
+    const char enclosure = parser->config->enclosure;
+
+    while (p < end) {
+        if (parser->skip_newline) {
+            parser->skip_newline = false;
+            if (*p == '\n') {
+                p++;
+                continue;
+            }
+        }
+
+        const char *terminator = find_terminator(p, end, enclosure, &parser->in_quotes);
+        if (!terminator) {
+            return append_pending(parser, p, end - p) ? CSV_PUSH_OK : CSV_PUSH_ERROR_MEMORY_ALLOCATION;
+        }
+
+        CSVPushResult result;
+        if (parser->pending_length == 0) {
+            result = emit_record(parser, p, terminator - p);
+        } else if (!append_pending(parser, p, terminator - p)) {
+            result = CSV_PUSH_ERROR_MEMORY_ALLOCATION;
+        } else {
+            size_t pending_length = parser->pending_length;
+            parser->pending_length = 0;
+            result = emit_record(parser, parser->pending, pending_length);
+        }
+        if (result != CSV_PUSH_OK) {
+            return result;
+        }
+
+        parser->in_quotes = false;
+        p = terminator + 1;
+        if (*terminator == '\r') {
+            parser->skip_newline = true;
+        }
+    }
+    return CSV_PUSH_OK;
+}
+
+CSVPushResult csv_push_parser_feed(CSVPushParser *parser, const char *data, size_t length) {
+    if (!parser || (!data && length > 0)) {
+        return CSV_PUSH_ERROR_NULL_POINTER;
+    }
+    if (parser->status != CSV_PUSH_OK) {
+        return parser->status;
+    }
+
+    parser->status = feed_records(parser, data, data + length);
+    return parser->status;
+}
+
+CSVPushResult csv_push_parser_finish(CSVPushParser *parser) {
+    if (!parser) {
+        return CSV_PUSH_ERROR_NULL_POINTER;
+    }
+    if (parser->status != CSV_PUSH_OK) {
+        return parser->status;
+    }
+
+    CSVPushResult result = CSV_PUSH_OK;
+    if (parser->pending_length > 0) {
+        size_t length = parser->pending_length;
+        parser->pending_length = 0;
+        result = emit_record(parser, parser->pending, length);
+    }
+
+    parser->status = result == CSV_PUSH_OK ? CSV_PUSH_ERROR_FINISHED : result;
+    return result;
+}
@@ -0,0 +1,51 @@
+#ifndef CSV_PUSH_H
+#define CSV_PUSH_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "csv_config.h"
+#include "csv_reader.h"
+
+typedef enum {
+    CSV_PUSH_OK = 0,
+    CSV_PUSH_STOPPED,
+    CSV_PUSH_ERROR_NULL_POINTER,
+    CSV_PUSH_ERROR_MEMORY_ALLOCATION,
+    CSV_PUSH_ERROR_PARSE,
+    CSV_PUSH_ERROR_FINISHED
+} CSVPushResult;
+
+/*
+ * Called once per record, header row included, with its 1-based record
+ * number; return false to stop. Fields are unescaped copies that are only
+ * valid during the call.
+ */
+typedef bool (*CSVPushRecordCallback)(const CSVRecord *record, int line_number, void *user_data);
+
+typedef struct CSVPushParser CSVPushParser;
+
+/*
+ * Incremental parser for input that arrives in arbitrary fragments. Quote
+ * state and a '\r' waiting for its '\n' carry over between feeds, so chunk
+ * boundaries may fall anywhere. Records that lie entirely inside one chunk
+ * are parsed in place; only the unfinished tail of a chunk is buffered.
+ * config must outlive the parser.
+ */
+CSVPushParser* csv_push_parser_create(const CSVConfig *config, CSVPushRecordCallback callback, void *user_data);
+void csv_push_parser_free(CSVPushParser *parser);
+
+/*
+ * Parses every record completed by data. Once a call returns anything but
+ * CSV_PUSH_OK the parser is done and later calls return the same result.
+ */
+CSVPushResult csv_push_parser_feed(CSVPushParser *parser, const char *data, size_t length);
+
+/* Emits the final record when the input does not end with a terminator. */
+CSVPushResult csv_push_parser_finish(CSVPushParser *parser);
+
+/* Message, record number and column of the record that failed to parse, or NULL. */
+const char* csv_push_parser_error(const CSVPushParser *parser, int *line, int *column);
+
+const char* csv_push_error_string(CSVPushResult result);
+
+#endif
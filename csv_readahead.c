@@ -0,0 +1,236 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "csv_readahead.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+typedef struct {
+    char *data;
+    size_t length;
+} ReadAheadSlot;
+
+struct CSVReadAhead {
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    int fd;
+    bool seekable;
+    ReadAheadSlot *slots;
+    int slot_count;
+    size_t slot_size;
+    int head;
+    int tail;
+    int ready;
+    size_t consumed;
+    off_t next_offset;
+    unsigned long generation;
+    bool eof;
+    bool failed;
+    bool stop;
+    CSVReadAheadStats stats;
+};
+
+const char* csv_readahead_error_string(CSVReadAheadResult result) {
+    switch (result) {
+        case CSV_READAHEAD_OK: return "Success";
+        case CSV_READAHEAD_ERROR_NULL_POINTER: return "Null pointer error";
+        case CSV_READAHEAD_ERROR_MEMORY_ALLOCATION: return "Memory allocation failed";
+        case CSV_READAHEAD_ERROR_THREAD: return "Failed to start read-ahead thread";
+        case CSV_READAHEAD_ERROR_FILE_READ: return "Failed to read from file";
+        case CSV_READAHEAD_ERROR_FILE_SEEK: return "Failed to seek in file";
+        default: return "Unknown error";
+    }
+}
+
+static ssize_t read_slot(CSVReadAhead *readahead, char *dest, off_t offset) {
+    ssize_t n;
+    do {
+        n = readahead->seekable ? pread(readahead->fd, dest, readahead->slot_size, offset)
+                                : read(readahead->fd, dest, readahead->slot_size);
+    } while (n < 0 && errno == EINTR);
+    return n;
+}
+
+/*
+ * The producer reads into the tail slot without holding the lock; the
+ * consumer only touches slots counted in ready. A seek bumps generation,
+ * so a read that was in flight across the seek is simply discarded.
+ */
+static void* readahead_main(void *arg) {
+    CSVReadAhead *readahead = arg;
+
+    pthread_mutex_lock(&readahead->mutex);
+    for (;;) {
+        bool counted = false;
+        while (!readahead->stop && (readahead->ready == readahead->slot_count || readahead->eof || readahead->failed)) {
+            if (!counted && readahead->ready == readahead->slot_count) {
+                readahead->stats.producer_stalls++;
+                counted = true;
+            }
+            pthread_cond_wait(&readahead->cond, &readahead->mutex);
+        }
+        if (readahead->stop) break;
+
+        ReadAheadSlot *slot = &readahead->slots[readahead->tail];
+        unsigned long generation = readahead->generation;
+        off_t offset = readahead->next_offset;
+        pthread_mutex_unlock(&readahead->mutex);
+
+        ssize_t n = read_slot(readahead, slot->data, offset);
+
+        pthread_mutex_lock(&readahead->mutex);
+        if (generation != readahead->generation) continue;
+
+        if (n < 0) {
+            readahead->failed = true;
+        } else if (n == 0) {
+            readahead->eof = true;
+        } else {
+            slot->length = (size_t)n;
+            readahead->next_offset += n;
+            readahead->tail = (readahead->tail + 1) % readahead->slot_count;
+            readahead->ready++;
+            readahead->stats.bytes_read += (uint64_t)n;
+            readahead->stats.buffers_filled++;
+        }
+        pthread_cond_broadcast(&readahead->cond);
+    }
+    pthread_mutex_unlock(&readahead->mutex);
+    return NULL;
+}
+
+static void free_slots(CSVReadAhead *readahead) {
+    if (readahead->slots) {
+        for (int i = 0; i < readahead->slot_count; i++) {
+            free(readahead->slots[i].data);
+        }
+    }
+    free(readahead->slots);
+}
+
+CSVReadAheadResult csv_readahead_start(CSVReadAhead **readahead, int fd, off_t offset,
+                                       int buffer_count, size_t buffer_size) {
+    if (!readahead || fd < 0) return CSV_READAHEAD_ERROR_NULL_POINTER;
+    *readahead = NULL;
+
+    if (buffer_count <= 0) buffer_count = CSV_READAHEAD_DEFAULT_BUFFERS;
+    if (buffer_count > CSV_READAHEAD_MAX_BUFFERS) buffer_count = CSV_READAHEAD_MAX_BUFFERS;
+    if (buffer_size == 0) buffer_size = CSV_READAHEAD_DEFAULT_BUFFER_SIZE;
+
+    CSVReadAhead *created = calloc(1, sizeof(CSVReadAhead));
+    if (!created) return CSV_READAHEAD_ERROR_MEMORY_ALLOCATION;
+
+    created->fd = fd;
+    created->seekable = lseek(fd, 0, SEEK_CUR) != (off_t)-1;
+    created->next_offset = offset;
+    created->slot_count = buffer_count;
+    created->slot_size = buffer_size;
+    created->slots = calloc((size_t)buffer_count, sizeof(ReadAheadSlot));
+    if (!created->slots) {
+        free(created);
+        return CSV_READAHEAD_ERROR_MEMORY_ALLOCATION;
+    }
+    for (int i = 0; i < buffer_count; i++) {
+        created->slots[i].data = malloc(buffer_size);
+        if (!created->slots[i].data) {
+            free_slots(created);
+            free(created);
+            return CSV_READAHEAD_ERROR_MEMORY_ALLOCATION;
+        }
+    }
+
+    pthread_mutex_init(&created->mutex, NULL);
+    pthread_cond_init(&created->cond, NULL);
+    if (pthread_create(&created->thread, NULL, readahead_main, created) != 0) {
+        pthread_cond_destroy(&created->cond);
+        pthread_mutex_destroy(&created->mutex);
+        free_slots(created);
+        free(created);
+        return CSV_READAHEAD_ERROR_THREAD;
+    }
+
+    *readahead = created;
+    return CSV_READAHEAD_OK;
+}
+
+ssize_t csv_readahead_read(CSVReadAhead *readahead, char *dest, size_t capacity) {
+    if (!readahead || !dest) return -1;
+    if (capacity == 0) return 0;
+
+    pthread_mutex_lock(&readahead->mutex);
+    if (readahead->ready == 0 && !readahead->eof && !readahead->failed) {
+        readahead->stats.consumer_stalls++;
+        do {
+            pthread_cond_wait(&readahead->cond, &readahead->mutex);
+        } while (readahead->ready == 0 && !readahead->eof && !readahead->failed);
+    }
+    if (readahead->ready == 0) {
+        ssize_t result = readahead->failed ? -1 : 0;
+        pthread_mutex_unlock(&readahead->mutex);
+        return result;
+    }
+    ReadAheadSlot *slot = &readahead->slots[readahead->head];
+    size_t consumed = readahead->consumed;
+    pthread_mutex_unlock(&readahead->mutex);
+
+    size_t n = slot->length - consumed;
+    if (n > capacity) n = capacity;
+    memcpy(dest, slot->data + consumed, n);
+
+    pthread_mutex_lock(&readahead->mutex);
+    readahead->consumed += n;
+    if (readahead->consumed == slot->length) {
+        readahead->consumed = 0;
+        readahead->head = (readahead->head + 1) % readahead->slot_count;
+        readahead->ready--;
+        pthread_cond_broadcast(&readahead->cond);
+    }
+    pthread_mutex_unlock(&readahead->mutex);
+    return (ssize_t)n;
+}
+
+CSVReadAheadResult csv_readahead_seek(CSVReadAhead *readahead, off_t offset) {
+    if (!readahead) return CSV_READAHEAD_ERROR_NULL_POINTER;
+    if (!readahead->seekable || offset < 0) return CSV_READAHEAD_ERROR_FILE_SEEK;
+
+    pthread_mutex_lock(&readahead->mutex);
+    readahead->generation++;
+    readahead->head = 0;
+    readahead->tail = 0;
+    readahead->ready = 0;
+    readahead->consumed = 0;
+    readahead->next_offset = offset;
+    readahead->eof = false;
+    readahead->failed = false;
+    pthread_cond_broadcast(&readahead->cond);
+    pthread_mutex_unlock(&readahead->mutex);
+    return CSV_READAHEAD_OK;
+}
+
+void csv_readahead_get_stats(CSVReadAhead *readahead, CSVReadAheadStats *stats) {
+    if (!stats) return;
+    memset(stats, 0, sizeof(CSVReadAheadStats));
+    if (!readahead) return;
+
+    pthread_mutex_lock(&readahead->mutex);
+    *stats = readahead->stats;
+    pthread_mutex_unlock(&readahead->mutex);
+}
+
+void csv_readahead_stop(CSVReadAhead *readahead) {
+    if (!readahead) return;
+
+    pthread_mutex_lock(&readahead->mutex);
+    readahead->stop = true;
+    pthread_cond_broadcast(&readahead->cond);
+    pthread_mutex_unlock(&readahead->mutex);
+    pthread_join(readahead->thread, NULL);
+
+    pthread_cond_destroy(&readahead->cond);
+    pthread_mutex_destroy(&readahead->mutex);
+    free_slots(readahead);
+    free(readahead);
+}
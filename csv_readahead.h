@@ -0,0 +1,51 @@
+#ifndef CSV_READAHEAD_H
+#define CSV_READAHEAD_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/types.h>
+
+#define CSV_READAHEAD_DEFAULT_BUFFERS 4
+#define CSV_READAHEAD_DEFAULT_BUFFER_SIZE (1024 * 1024)
+#define CSV_READAHEAD_MAX_BUFFERS 64
+
+typedef enum {
+    CSV_READAHEAD_OK = 0,
+    CSV_READAHEAD_ERROR_NULL_POINTER,
+    CSV_READAHEAD_ERROR_MEMORY_ALLOCATION,
+    CSV_READAHEAD_ERROR_THREAD,
+    CSV_READAHEAD_ERROR_FILE_READ,
+    CSV_READAHEAD_ERROR_FILE_SEEK
+} CSVReadAheadResult;
+
+typedef struct {
+    uint64_t bytes_read;
+    size_t buffers_filled;
+    size_t consumer_stalls;
+    size_t producer_stalls;
+} CSVReadAheadStats;
+
+typedef struct CSVReadAhead CSVReadAhead;
+
+/*
+ * A producer thread reads fd sequentially from offset into a ring of
+ * buffer_count buffers of buffer_size bytes while the consumer drains
+ * them with csv_readahead_read. A consumer stall is a read that had to
+ * wait for the producer; a producer stall is the ring being full.
+ */
+CSVReadAheadResult csv_readahead_start(CSVReadAhead **readahead, int fd, off_t offset,
+                                       int buffer_count, size_t buffer_size);
+
+/* Same contract as read(2): bytes copied, 0 at end of file, -1 on error. */
+ssize_t csv_readahead_read(CSVReadAhead *readahead, char *dest, size_t capacity);
+
+/* Drops everything buffered and restarts the producer at offset. */
+CSVReadAheadResult csv_readahead_seek(CSVReadAhead *readahead, off_t offset);
+
+void csv_readahead_get_stats(CSVReadAhead *readahead, CSVReadAheadStats *stats);
+void csv_readahead_stop(CSVReadAhead *readahead);
+
+const char* csv_readahead_error_string(CSVReadAheadResult result);
+
+#endif
@@ -3,8 +3,70 @@
 #include <string.h>
 #include "csv_reader.h"
 #include "csv_parser.h"
+#include "csv_count.h"
 #include "arena.h"
 
+static bool open_input(CSVBuffer *input, const CSVConfig *config) {
+    if (config->readerBackend == CSV_READER_BACKEND_MMAP &&
+        csv_buffer_open_mapped(input, config->path) == CSV_BUFFER_OK) {
+        return true;
+    }
+
+    if (csv_buffer_open(input, config->path, CSV_BUFFER_DEFAULT_SIZE) != CSV_BUFFER_OK) {
+        return false;
+    }
+
+    if (config->readerBackend == CSV_READER_BACKEND_IO_URING &&
+        csv_buffer_start_uring(input, config->readAheadBuffers, config->readAheadBufferSize) == CSV_BUFFER_OK) {
+        return true;
+    }
+
+    /* Read-ahead is an optimization; without a thread the buffer reads inline. */
+    if (config->readAheadBuffers > 0) {
+        csv_buffer_start_readahead(input, config->readAheadBuffers, config->readAheadBufferSize);
+    }
+    return true;
+}
+
+static void load_headers(CSVReader *reader) {
+    size_t length;
+    const char *line = csv_buffer_next_record(&reader->input, reader->config->enclosure, &length);
+    if (!line) {
+        return;
+    }
+
+    reader->line_number++;
+    CSVParseResult result = csv_parser_parse_record(reader->parser, line, length, reader->persistent_arena,
+                                                    reader->line_number, NULL);
+    if (result.success) {
+        reader->cached_headers = result.fields.fields;
+        reader->cached_header_count = result.fields.count;
+        reader->headers_loaded = true;
+        csv_header_map_build(&reader->header_map, reader->cached_headers, reader->cached_header_count,
+                             reader->persistent_arena);
+    }
+}
+
+/*
+ * Picks the parser's unquoted fast path from config->quoting, sampling the
+ * next buffered bytes for DETECT. The parser drops the fast path by itself
+ * at the first enclosure, so a wrong guess only costs speed.
+ */
+static void detect_quoting(CSVReader *reader) {
+    CSVQuoting quoting = reader->config->quoting;
+    if (quoting != CSV_QUOTING_DETECT) {
+        reader->parser->unquoted = quoting == CSV_QUOTING_NONE;
+        return;
+    }
+
+    size_t available = 0;
+    const char *data = csv_buffer_peek(&reader->input, &available, NULL);
+    if (available > CSV_BUFFER_DEFAULT_SIZE) {
+        available = CSV_BUFFER_DEFAULT_SIZE;
+    }
+    reader->parser->unquoted = data && !memchr(data, reader->config->enclosure, available);
+}
+
 CSVReader* csv_reader_init_with_config(Arena *persistent_arena, Arena *temp_arena, CSVConfig *config) {
     void *ptr;
     ArenaResult result = arena_alloc(persistent_arena, sizeof(CSVReader), &ptr);
@@ -13,8 +75,8 @@ CSVReader* csv_reader_init_with_config(Arena *persistent_arena, Arena *temp_aren
     }
 
     CSVReader *reader = (CSVReader*)ptr;
-    reader->file = fopen(config->path, "r");
-    if (!reader->file) {
+    reader->parser = csv_parser_init(persistent_arena, config);
+    if (!reader->parser || !open_input(&reader->input, config)) {
         return NULL;
     }
 
@@ -24,22 +86,19 @@ CSVReader* csv_reader_init_with_config(Arena *persistent_arena, Arena *temp_aren
     reader->headers_loaded = false;
     reader->cached_header_count = 0;
     reader->cached_headers = NULL;
+    csv_header_map_init(&reader->header_map);
     reader->line_number = 0;
     reader->current_record = NULL;
     reader->owns_arenas = false;
+    csv_index_init(&reader->index);
+    memset(&reader->projection, 0, sizeof(CSVProjection));
+    reader->filter = NULL;
+    memset(&reader->held_row, 0, sizeof(CSVHeldRow));
 
     if (config->hasHeader) {
-        char *line = read_full_record(reader->file, reader->persistent_arena);
-        if (line) {
-            reader->line_number++;
-            CSVParseResult result = csv_parse_line_inplace(line, reader->persistent_arena, config, reader->line_number);
-            if (result.success) {
-                reader->cached_headers = result.fields.fields;
-                reader->cached_header_count = result.fields.count;
-                reader->headers_loaded = true;
-            }
-        }
+        load_headers(reader);
     }
+    detect_quoting(reader);
 
     return reader;
 }
@@ -58,8 +117,8 @@ CSVReader* csv_reader_init_standalone(CSVConfig *config) {
         return NULL;
     }
 
-    ArenaResult p_result = arena_create(persistent_arena, 1024 * 1024);
-    ArenaResult t_result = arena_create(temp_arena, 1024 * 1024);
+    ArenaResult p_result = arena_create_growable(persistent_arena, 1024 * 1024, 0);
+    ArenaResult t_result = arena_create_growable(temp_arena, 1024 * 1024, 0);
 
     if (p_result != ARENA_OK || t_result != ARENA_OK) {
         if (p_result == ARENA_OK) arena_destroy(persistent_arena);
@@ -78,8 +137,8 @@ CSVReader* csv_reader_init_standalone(CSVConfig *config) {
         return NULL;
     }
 
-    reader->file = fopen(config->path, "r");
-    if (!reader->file) {
+    reader->parser = csv_parser_init(persistent_arena, config);
+    if (!reader->parser || !open_input(&reader->input, config)) {
         arena_destroy(persistent_arena);
         arena_destroy(temp_arena);
         free(persistent_arena);
@@ -94,41 +153,122 @@ CSVReader* csv_reader_init_standalone(CSVConfig *config) {
     reader->headers_loaded = false;
     reader->cached_header_count = 0;
     reader->cached_headers = NULL;
+    csv_header_map_init(&reader->header_map);
     reader->line_number = 0;
     reader->current_record = NULL;
     reader->owns_arenas = true;
+    csv_index_init(&reader->index);
+    memset(&reader->projection, 0, sizeof(CSVProjection));
+    reader->filter = NULL;
+    memset(&reader->held_row, 0, sizeof(CSVHeldRow));
 
     if (config->hasHeader) {
-        char *line = read_full_record(reader->file, reader->persistent_arena);
-        if (line) {
-            reader->line_number++;
-            CSVParseResult result = csv_parse_line_inplace(line, reader->persistent_arena, config, reader->line_number);
-            if (result.success) {
-                reader->cached_headers = result.fields.fields;
-                reader->cached_header_count = result.fields.count;
-                reader->headers_loaded = true;
-            }
-        }
+        load_headers(reader);
     }
+    detect_quoting(reader);
 
     return reader;
 }
 
-CSVRecord* csv_reader_next_record(CSVReader *reader) {
-    if (!reader || !reader->file) {
-        return NULL;
+/* Returns the next line the filter accepts, with the temp arena reset for parsing it. */
+static const char* next_matching_line(CSVReader *reader, size_t *length) {
+    for (;;) {
+        arena_reset(reader->temp_arena);
+
+        const char *line = csv_buffer_next_record_unquoted(&reader->input, reader->config->enclosure,
+                                                           &reader->parser->unquoted, length);
+        if (!line) {
+            return NULL;
+        }
+
+        reader->line_number++;
+        if (!reader->filter) {
+            return line;
+        }
+        if (csv_predicate_matches_line(reader->filter, line, *length, reader->config, reader->temp_arena)) {
+            arena_reset(reader->temp_arena);
+            return line;
+        }
     }
+}
 
+/*
+ * Frames and splits the next record in one pass over the read buffer.
+ * Returns false without consuming anything when the record has to take the
+ * two-pass path instead: a filter needs the raw line first, the record runs
+ * past the buffered bytes, or its quoting needs the full state machine.
+ */
+static bool scan_next_record(CSVReader *reader, Arena *arena, CSVParseResult *strings, CSVParseViewResult *views) {
     arena_reset(reader->temp_arena);
+    if (reader->filter) {
+        return false;
+    }
 
-    char *line = read_full_record(reader->file, reader->temp_arena);
+    size_t available;
+    bool at_end;
+    const char *data = csv_buffer_peek(&reader->input, &available, &at_end);
+    if (!data) {
+        return false;
+    }
+
+    ArenaRegion region = arena_begin_region(arena);
+    CSVRecordExtent extent;
+    int line_number = reader->line_number + 1;
+    if (views) {
+        *views = csv_parser_scan_views(reader->parser, data, available, at_end, arena, line_number,
+                                       &reader->projection, &extent);
+    } else {
+        *strings = csv_parser_scan_record(reader->parser, data, available, at_end, arena, line_number,
+                                          &reader->projection, &extent);
+    }
+    if (extent.status != CSV_SCAN_COMPLETE) {
+        arena_restore_region(&region);
+        return false;
+    }
+
+    csv_buffer_consume(&reader->input, extent.consumed);
+    reader->line_number = line_number;
+    return true;
+}
+
+static bool next_parsed_record(CSVReader *reader, Arena *arena, CSVParseResult *result) {
+    if (scan_next_record(reader, arena, result, NULL)) {
+        return true;
+    }
+
+    size_t length;
+    const char *line = next_matching_line(reader, &length);
     if (!line) {
+        return false;
+    }
+
+    *result = csv_parser_parse_record(reader->parser, line, length, arena, reader->line_number, &reader->projection);
+    return result->success;
+}
+
+static bool next_parsed_view(CSVReader *reader, CSVParseViewResult *result) {
+    if (scan_next_record(reader, reader->temp_arena, NULL, result)) {
+        return true;
+    }
+
+    size_t length;
+    const char *line = next_matching_line(reader, &length);
+    if (!line) {
+        return false;
+    }
+
+    *result = csv_parser_parse_views(reader->parser, line, length, reader->temp_arena, reader->line_number,
+                                     &reader->projection);
+    return result->success;
+}
+
+CSVRecord* csv_reader_next_record(CSVReader *reader) {
+    if (!reader || !csv_buffer_is_open(&reader->input)) {
         return NULL;
     }
 
-    reader->line_number++;
-    CSVParseResult result = csv_parse_line_inplace(line, reader->temp_arena, reader->config, reader->line_number);
-    if (!result.success) {
+    CSVParseResult result;
+    if (!next_parsed_record(reader, reader->temp_arena, &result)) {
         return NULL;
     }
 
@@ -146,12 +286,358 @@ CSVRecord* csv_reader_next_record(CSVReader *reader) {
     return record;
 }
 
+bool csv_record_batch_init(CSVRecordBatch *batch, size_t capacity) {
+    if (!batch || capacity == 0) {
+        return false;
+    }
+
+    memset(batch, 0, sizeof(CSVRecordBatch));
+    batch->records = malloc(capacity * sizeof(CSVRecord));
+    if (!batch->records) {
+        return false;
+    }
+    if (arena_create_growable(&batch->arena, 256 * 1024, 0) != ARENA_OK) {
+        free(batch->records);
+        batch->records = NULL;
+        return false;
+    }
+
+    batch->capacity = capacity;
+    return true;
+}
+
+void csv_record_batch_free(CSVRecordBatch *batch) {
+    if (!batch) {
+        return;
+    }
+
+    if (batch->records) {
+        arena_destroy(&batch->arena);
+        free(batch->records);
+    }
+    memset(batch, 0, sizeof(CSVRecordBatch));
+}
+
+size_t csv_reader_next_records(CSVReader *reader, CSVRecordBatch *batch, size_t max_records) {
+    if (!batch) {
+        return 0;
+    }
+    batch->count = 0;
+    if (!reader || !batch->records || batch->error || !csv_buffer_is_open(&reader->input)) {
+        return 0;
+    }
+
+    arena_reset(&batch->arena);
+    reader->current_record = NULL;
+    if (max_records > batch->capacity) {
+        max_records = batch->capacity;
+    }
+
+    while (batch->count < max_records) {
+        CSVParseResult result = {0};
+        if (!next_parsed_record(reader, &batch->arena, &result)) {
+            /* End of input leaves error NULL; a parse failure names it. */
+            batch->error = result.error;
+            batch->error_line = result.error_line;
+            batch->error_column = result.error_column;
+            break;
+        }
+
+        CSVRecord *record = &batch->records[batch->count++];
+        record->fields = result.fields.fields;
+        record->field_count = result.fields.count;
+    }
+
+    return batch->count;
+}
+
+bool csv_column_batch_init(CSVColumnBatch *batch, size_t row_capacity) {
+    if (!batch || row_capacity == 0 || row_capacity >= UINT32_MAX) {
+        return false;
+    }
+
+    memset(batch, 0, sizeof(CSVColumnBatch));
+    batch->row_capacity = row_capacity;
+    return true;
+}
+
+void csv_column_batch_free(CSVColumnBatch *batch) {
+    if (!batch) {
+        return;
+    }
+
+    for (size_t i = 0; i < batch->column_capacity; i++) {
+        free(batch->columns[i].offsets);
+        free(batch->columns[i].data);
+    }
+    free(batch->columns);
+    free(batch->names);
+    memset(batch, 0, sizeof(CSVColumnBatch));
+}
+
+const char* csv_column_batch_value(const CSVColumnBatch *batch, size_t column, size_t row, size_t *length) {
+    if (!batch || column >= batch->column_count || row >= batch->row_count) {
+        if (length) *length = 0;
+        return NULL;
+    }
+
+    const CSVColumn *values = &batch->columns[column];
+    if (length) *length = values->offsets[row + 1] - values->offsets[row];
+    return values->data + values->offsets[row];
+}
+
+/* Columns past the current count start empty in every row already stored. */
+static bool reserve_columns(CSVColumnBatch *batch, size_t column_count) {
+    if (column_count > batch->column_capacity) {
+        CSVColumn *columns = realloc(batch->columns, column_count * sizeof(CSVColumn));
+        if (!columns) {
+            return false;
+        }
+        batch->columns = columns;
+        memset(columns + batch->column_capacity, 0, (column_count - batch->column_capacity) * sizeof(CSVColumn));
+
+        const char **names = realloc(batch->names, column_count * sizeof(char*));
+        if (!names) {
+            return false;
+        }
+        batch->names = names;
+        batch->column_capacity = column_count;
+    }
+
+    for (size_t i = batch->column_count; i < column_count; i++) {
+        CSVColumn *column = &batch->columns[i];
+        if (!column->offsets) {
+            column->offsets = malloc((batch->row_capacity + 1) * sizeof(uint32_t));
+            if (!column->offsets) {
+                return false;
+            }
+        }
+        memset(column->offsets, 0, (batch->row_count + 1) * sizeof(uint32_t));
+        column->data_size = 0;
+    }
+    batch->column_count = column_count;
+    return true;
+}
+
+static void name_columns(CSVReader *reader, CSVColumnBatch *batch) {
+    for (size_t i = 0; i < batch->column_count; i++) {
+        batch->names[i] = NULL;
+    }
+    if (!reader->headers_loaded) {
+        return;
+    }
+
+    const CSVProjection *projection = &reader->projection;
+    for (size_t column = 0; column < (size_t)reader->cached_header_count; column++) {
+        size_t slot = column;
+        if (projection->output_count > 0) {
+            if (column >= projection->column_count || projection->slots[column] < 0) {
+                continue;
+            }
+            slot = (size_t)projection->slots[column];
+        }
+        if (slot < batch->column_count) {
+            batch->names[slot] = reader->cached_headers[column];
+        }
+    }
+}
+
+static bool append_value(CSVColumn *column, const CSVFieldView *view, char enclosure, size_t row) {
+    size_t needed = column->data_size + view->length;
+    if (needed > column->data_capacity) {
+        size_t capacity = column->data_capacity ? column->data_capacity : 4096;
+        while (capacity < needed) {
+            capacity *= 2;
+        }
+        char *data = realloc(column->data, capacity);
+        if (!data) {
+            return false;
+        }
+        column->data = data;
+        column->data_capacity = capacity;
+    }
+
+    column->data_size += csv_field_view_copy(view, enclosure, column->data + column->data_size);
+    column->offsets[row + 1] = (uint32_t)column->data_size;
+    return true;
+}
+
+/*
+ * Copies a row the batch could not take, escapes and all, so the next batch
+ * starts with it. The views it replaces point into the read buffer, which
+ * the next fill may move.
+ */
+static bool hold_row(CSVHeldRow *held, const FieldViewArray *row) {
+    size_t data_size = 0;
+    for (size_t i = 0; i < row->count; i++) {
+        data_size += row->fields[i].length;
+    }
+
+    if (row->count > held->fields.capacity) {
+        CSVFieldView *fields = realloc(held->fields.fields, row->count * sizeof(CSVFieldView));
+        if (!fields) {
+            return false;
+        }
+        held->fields.fields = fields;
+        held->fields.capacity = row->count;
+    }
+    if (data_size > held->data_capacity) {
+        char *data = realloc(held->data, data_size);
+        if (!data) {
+            return false;
+        }
+        held->data = data;
+        held->data_capacity = data_size;
+    }
+
+    size_t offset = 0;
+    for (size_t i = 0; i < row->count; i++) {
+        const CSVFieldView *view = &row->fields[i];
+        if (view->length > 0) {
+            memcpy(held->data + offset, view->data, view->length);
+        }
+        held->fields.fields[i] = (CSVFieldView){ held->data + offset, view->length, view->needs_unescape };
+        offset += view->length;
+    }
+    held->fields.count = row->count;
+    held->pending = true;
+    return true;
+}
+
+static void fail_column_batch(CSVColumnBatch *batch, const char *error, int line, int column) {
+    batch->error = error;
+    batch->error_line = line;
+    batch->error_column = column;
+}
+
+/*
+ * Rows are split into views in the temp arena and copied straight into the
+ * column buffers, so each cell is written once and no per-cell pointer is
+ * kept. Every check runs before the first cell of a row is stored, and a
+ * row the batch cannot take is held for the next call rather than dropped.
+ */
+size_t csv_reader_next_column_batch(CSVReader *reader, CSVColumnBatch *batch, size_t max_rows) {
+    if (!batch) {
+        return 0;
+    }
+    batch->row_count = 0;
+    batch->column_count = 0;
+    if (!reader || batch->error || !csv_buffer_is_open(&reader->input)) {
+        return 0;
+    }
+
+    reader->current_record = NULL;
+    if (max_rows > batch->row_capacity) {
+        max_rows = batch->row_capacity;
+    }
+
+    char enclosure = reader->config->enclosure;
+    bool fixed_width = reader->projection.output_count > 0 || reader->headers_loaded;
+    CSVHeldRow *held = &reader->held_row;
+    while (batch->row_count < max_rows) {
+        const FieldViewArray *row;
+        CSVParseViewResult result = {0};
+        if (held->pending) {
+            row = &held->fields;
+        } else if (next_parsed_view(reader, &result)) {
+            row = &result.fields;
+        } else {
+            if (result.error) {
+                fail_column_batch(batch, result.error, result.error_line, result.error_column);
+            }
+            break;
+        }
+
+        size_t column_count = batch->column_count;
+        if (!fixed_width || batch->row_count == 0) {
+            if (reader->projection.output_count == 0 && reader->headers_loaded) {
+                column_count = (size_t)reader->cached_header_count;
+            } else if (row->count > column_count) {
+                column_count = row->count;
+            }
+        }
+
+        bool fits = true;
+        for (size_t i = 0; i < column_count && fits; i++) {
+            size_t data_size = i < batch->column_count ? batch->columns[i].data_size : 0;
+            size_t field_length = i < row->count ? row->fields[i].length : 0;
+            fits = data_size + field_length <= UINT32_MAX;
+        }
+        if (!fits && batch->row_count == 0) {
+            held->pending = false;
+            fail_column_batch(batch, "Field too large for a column batch", (int)reader->line_number, 0);
+            break;
+        }
+
+        const CSVFieldView empty = { "", 0, false };
+        size_t row_index = batch->row_count;
+        size_t named = batch->column_count;
+        bool stored = fits && reserve_columns(batch, column_count);
+        if (stored && batch->column_count > named) {
+            name_columns(reader, batch);
+        }
+        size_t appended = 0;
+        for (; appended < batch->column_count && stored; appended++) {
+            const CSVFieldView *view = appended < row->count ? &row->fields[appended] : &empty;
+            stored = append_value(&batch->columns[appended], view, enclosure, row_index);
+        }
+        if (!stored) {
+            for (size_t i = 0; i < appended; i++) {
+                batch->columns[i].data_size = batch->columns[i].offsets[row_index];
+            }
+            bool kept = row == &held->fields || hold_row(held, row);
+            if (fits || !kept) {
+                fail_column_batch(batch, "Memory allocation failed", (int)reader->line_number, 0);
+            }
+            break;
+        }
+        held->pending = false;
+        batch->row_count++;
+    }
+
+    return batch->row_count;
+}
+
+CSVRecordView* csv_reader_next_record_view(CSVReader *reader) {
+    if (!reader || !csv_buffer_is_open(&reader->input)) {
+        return NULL;
+    }
+
+    CSVParseViewResult result;
+    if (!next_parsed_view(reader, &result)) {
+        return NULL;
+    }
+
+    void *ptr;
+    ArenaResult arena_result = arena_alloc(reader->temp_arena, sizeof(CSVRecordView), &ptr);
+    if (arena_result != ARENA_OK) {
+        return NULL;
+    }
+
+    CSVRecordView *record = (CSVRecordView*)ptr;
+    record->fields = result.fields.fields;
+    record->field_count = result.fields.count;
+    record->enclosure = reader->config->enclosure;
+    reader->current_record = NULL;
+
+    return record;
+}
+
+char* csv_reader_view_field_string(CSVReader *reader, const CSVRecordView *record, size_t index) {
+    if (!reader || !record || index >= record->field_count) {
+        return NULL;
+    }
+
+    return csv_field_view_to_string(&record->fields[index], record->enclosure, reader->temp_arena);
+}
+
 void csv_reader_free(CSVReader *reader) {
     if (reader) {
-        if (reader->file) {
-            fclose(reader->file);
-            reader->file = NULL;
-        }
+        csv_buffer_close(&reader->input);
+        csv_index_free(&reader->index);
+        csv_reader_clear_projection(reader);
+        free(reader->held_row.fields.fields);
+        free(reader->held_row.data);
 
         if (reader->owns_arenas) {
             if (reader->persistent_arena) {
@@ -192,16 +678,18 @@ char** csv_reader_get_headers(CSVReader *reader, int *header_count) {
 }
 
 void csv_reader_rewind(CSVReader *reader) {
-    if (reader && reader->file) {
-        rewind(reader->file);
+    if (reader && csv_buffer_is_open(&reader->input)) {
+        csv_buffer_seek(&reader->input, 0);
         reader->line_number = 0;
+        reader->held_row.pending = false;
 
         if (reader->config->hasHeader && reader->headers_loaded) {
-            char *line = read_full_record(reader->file, reader->persistent_arena);
+            const char *line = csv_buffer_next_record(&reader->input, reader->config->enclosure, NULL);
             if (line) {
                 reader->line_number = 1;
             }
         }
+        detect_quoting(reader);
     }
 }
 
@@ -211,99 +699,270 @@ int csv_reader_set_config(CSVReader *reader, Arena *persistent_arena, Arena *tem
     }
 
     reader->config = (CSVConfig*)config;
+    reader->parser->config = reader->config;
     reader->persistent_arena = persistent_arena;
     reader->temp_arena = temp_arena;
+    if (csv_buffer_is_open(&reader->input)) {
+        detect_quoting(reader);
+    }
     return 1;
 }
 
 long csv_reader_get_record_count(CSVReader *reader) {
-    if (!reader || !reader->file) {
+    if (!reader || !csv_buffer_is_open(&reader->input)) {
         return -1;
     }
 
-    long current_pos = ftell(reader->file);
-    if (current_pos == -1) {
+    bool has_header = reader->config && reader->config->hasHeader;
+    bool skip_empty_lines = reader->config && reader->config->skipEmptyLines;
+
+    if (!skip_empty_lines && csv_index_is_built(&reader->index) && (!has_header || reader->headers_loaded)) {
+        return reader->index.record_count;
+    }
+
+    char enclosure = csv_config_get_enclosure(reader->config);
+    long skip_records = has_header ? 1 : 0;
+
+    if (reader->input.source != CSV_BUFFER_SOURCE_READ) {
+        return csv_count_records(reader->input.data, reader->input.end, enclosure, skip_empty_lines, skip_records);
+    }
+
+    return csv_count_fd(reader->input.fd, enclosure, skip_empty_lines, skip_records);
+}
+
+long csv_reader_get_position(CSVReader *reader) {
+    if (!reader || !csv_buffer_is_open(&reader->input)) {
         return -1;
     }
 
-    rewind(reader->file);
+    return reader->line_number;
+}
 
-    long record_count = 0;
+int csv_reader_seek(CSVReader *reader, long position) {
+    if (!reader || !csv_buffer_is_open(&reader->input) || position < 0) {
+        return 0;
+    }
 
-    if (reader->config && reader->config->hasHeader) {
-        char *header_line = read_full_record(reader->file, reader->persistent_arena);
-        if (!header_line) {
-            fseek(reader->file, current_pos, SEEK_SET);
-            return 0;
-        }
+    if (!csv_index_is_built(&reader->index) && csv_config_get_index_stride(reader->config) > 0) {
+        csv_reader_build_index(reader);
+    }
+
+    off_t offset;
+    long remaining;
+    if (csv_index_lookup(&reader->index, position, &offset, &remaining) &&
+        csv_buffer_seek(&reader->input, offset) == CSV_BUFFER_OK) {
+        reader->held_row.pending = false;
+        long header_lines = (reader->config->hasHeader && reader->headers_loaded) ? 1 : 0;
+        reader->line_number = header_lines + (position - remaining);
+        position = remaining;
+    } else {
+        csv_reader_rewind(reader);
     }
 
-    while (1) {
-        char *line = read_full_record(reader->file, reader->persistent_arena);
+    for (long i = 0; i < position; i++) {
+        const char *line = csv_buffer_next_record_unquoted(&reader->input, reader->config->enclosure,
+                                                           &reader->parser->unquoted, NULL);
         if (!line) {
-            break;
+            return 0;
         }
+        reader->line_number++;
+    }
 
-        if (reader->config && reader->config->skipEmptyLines) {
-            bool is_empty = true;
-            for (int i = 0; line[i] != '\0'; i++) {
-                if (line[i] != ' ' && line[i] != '\t' && line[i] != '\r' && line[i] != '\n') {
-                    is_empty = false;
-                    break;
-                }
-            }
-            if (is_empty) {
-                continue;
-            }
+    return 1;
+}
+
+static bool index_sidecar_path(const CSVConfig *config, char *path, size_t size) {
+    size_t length = strlen(config->path);
+    size_t suffix_length = strlen(CSV_INDEX_SIDECAR_SUFFIX);
+    if (length == 0 || length + suffix_length + 1 > size) {
+        return false;
+    }
+
+    memcpy(path, config->path, length);
+    memcpy(path + length, CSV_INDEX_SIDECAR_SUFFIX, suffix_length + 1);
+    return true;
+}
+
+int csv_reader_build_index(CSVReader *reader) {
+    if (!reader || !csv_buffer_is_open(&reader->input)) {
+        return 0;
+    }
+
+    int configured_stride = csv_config_get_index_stride(reader->config);
+    size_t stride = configured_stride > 0 ? (size_t)configured_stride : CSV_INDEX_DEFAULT_STRIDE;
+    char enclosure = csv_config_get_enclosure(reader->config);
+
+    off_t resume_offset = csv_buffer_tell(&reader->input);
+    long resume_line = reader->line_number;
+
+    csv_reader_rewind(reader);
+    off_t data_start = csv_buffer_tell(&reader->input);
+
+    char sidecar[MAX_PATH_LENGTH + 8];
+    bool persist = csv_config_get_persist_index(reader->config) &&
+                   index_sidecar_path(reader->config, sidecar, sizeof(sidecar));
+
+    bool ready = false;
+    if (persist && csv_index_load(&reader->index, sidecar, &reader->input) == CSV_INDEX_OK) {
+        ready = reader->index.stride == stride && reader->index.enclosure == enclosure &&
+                reader->index.offsets[0] == data_start;
+        if (!ready) {
+            csv_index_free(&reader->index);
         }
+    }
 
-        record_count++;
+    if (!ready) {
+        ready = csv_index_build(&reader->index, &reader->input, enclosure, stride) == CSV_INDEX_OK;
+        if (ready && persist) {
+            csv_index_save(&reader->index, sidecar);
+        }
     }
 
-    fseek(reader->file, current_pos, SEEK_SET);
+    csv_buffer_seek(&reader->input, resume_offset);
+    reader->line_number = resume_line;
 
-    return record_count;
+    return ready ? 1 : 0;
 }
 
-long csv_reader_get_position(CSVReader *reader) {
-    if (!reader || !reader->file) {
+int csv_reader_has_next(CSVReader *reader) {
+    if (!reader || !csv_buffer_is_open(&reader->input)) {
+        return 0;
+    }
+
+    return csv_buffer_has_data(&reader->input);
+}
+
+int csv_reader_column_index(CSVReader *reader, const char *name) {
+    if (!reader || !reader->headers_loaded) {
         return -1;
     }
 
-    return reader->line_number;
+    return csv_header_map_find(&reader->header_map, name);
 }
 
-int csv_reader_seek(CSVReader *reader, long position) {
-    if (!reader || !reader->file || position < 0) {
+char* csv_reader_get_field(CSVReader *reader, const CSVRecord *record, const char *name) {
+    if (!record) {
+        return NULL;
+    }
+
+    int column = csv_reader_column_index(reader, name);
+    if (column < 0) {
+        return NULL;
+    }
+
+    if (reader->projection.output_count > 0) {
+        if ((size_t)column >= reader->projection.column_count) {
+            return NULL;
+        }
+        column = reader->projection.slots[column];
+        if (column < 0) {
+            return NULL;
+        }
+    }
+
+    return (size_t)column < record->field_count ? record->fields[column] : NULL;
+}
+
+void csv_reader_clear_projection(CSVReader *reader) {
+    if (!reader) {
+        return;
+    }
+
+    free(reader->projection.slots);
+    memset(&reader->projection, 0, sizeof(CSVProjection));
+}
+
+int csv_reader_set_projection_indices(CSVReader *reader, const int *indices, size_t count) {
+    if (!reader || (count > 0 && !indices)) {
         return 0;
     }
+    if (count == 0) {
+        csv_reader_clear_projection(reader);
+        return 1;
+    }
 
-    csv_reader_rewind(reader);
+    int max_index = -1;
+    for (size_t i = 0; i < count; i++) {
+        if (indices[i] < 0 || (reader->headers_loaded && indices[i] >= reader->cached_header_count)) {
+            return 0;
+        }
+        if (indices[i] > max_index) {
+            max_index = indices[i];
+        }
+    }
 
-    for (long i = 0; i < position; i++) {
-        arena_reset(reader->temp_arena);
-        char *line = read_full_record(reader->file, reader->temp_arena);
-        if (!line) {
+    size_t column_count = (size_t)max_index + 1;
+    int *slots = malloc(column_count * sizeof(int));
+    if (!slots) {
+        return 0;
+    }
+    for (size_t i = 0; i < column_count; i++) {
+        slots[i] = -1;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (slots[indices[i]] >= 0) {
+            free(slots);
             return 0;
         }
-        reader->line_number++;
+        slots[indices[i]] = (int)i;
     }
 
+    csv_reader_clear_projection(reader);
+    reader->projection.slots = slots;
+    reader->projection.column_count = column_count;
+    reader->projection.output_count = count;
     return 1;
 }
 
-int csv_reader_has_next(CSVReader *reader) {
-    if (!reader || !reader->file) {
+int csv_reader_set_projection(CSVReader *reader, const char **names, size_t count) {
+    if (!reader || (count > 0 && !names)) {
+        return 0;
+    }
+    if (count == 0) {
+        csv_reader_clear_projection(reader);
+        return 1;
+    }
+    if (!reader->headers_loaded) {
+        return 0;
+    }
+
+    int *indices = malloc(count * sizeof(int));
+    if (!indices) {
         return 0;
     }
 
-    long current_pos = ftell(reader->file);
-    if (current_pos == -1) {
+    for (size_t i = 0; i < count; i++) {
+        indices[i] = csv_header_map_find(&reader->header_map, names[i]);
+        if (indices[i] < 0) {
+            free(indices);
+            return 0;
+        }
+    }
+
+    int success = csv_reader_set_projection_indices(reader, indices, count);
+    free(indices);
+    return success;
+}
+
+int csv_reader_set_filter(CSVReader *reader, const CSVPredicate *predicate) {
+    if (!reader) {
         return 0;
     }
 
-    int c = fgetc(reader->file);
-    fseek(reader->file, current_pos, SEEK_SET);
+    reader->filter = predicate;
+    return 1;
+}
 
-    return c != EOF;
-}
\ No newline at end of file
+bool csv_reader_get_read_ahead_stats(CSVReader *reader, CSVReadAheadStats *stats) {
+    if (!reader || (!reader->input.readahead && !reader->input.uring)) {
+        if (stats) memset(stats, 0, sizeof(CSVReadAheadStats));
+        return false;
+    }
+
+    if (reader->input.uring) {
+        csv_uring_get_stats(reader->input.uring, stats);
+    } else {
+        csv_readahead_get_stats(reader->input.readahead, stats);
+    }
+    return true;
+}
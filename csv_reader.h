@@ -2,7 +2,13 @@
 #define CSV_READER_H
 
 #include <stdio.h>
+#include <stdint.h>
 #include "csv_config.h"
+#include "csv_buffer.h"
+#include "csv_parser.h"
+#include "csv_index.h"
+#include "csv_filter.h"
+#include "csv_headers.h"
 #include "arena.h"
 
 typedef struct {
@@ -11,23 +17,119 @@ typedef struct {
 } CSVRecord;
 
 typedef struct {
-    FILE *file;
+    CSVFieldView *fields;
+    size_t field_count;
+    char enclosure;
+} CSVRecordView;
+
+/*
+ * Caller-owned batch of records. Every fill resets the batch arena, so
+ * records stay valid until the next csv_reader_next_records call on it.
+ * error is set, with the failing line and column, when a record fails to
+ * parse.
+ */
+typedef struct {
+    CSVRecord *records;
+    size_t count;
+    size_t capacity;
+    Arena arena;
+    const char *error;
+    int error_line;
+    int error_column;
+} CSVRecordBatch;
+
+/* A row a column batch read but could not store, replayed by the next one. */
+typedef struct {
+    FieldViewArray fields;
+    char *data;
+    size_t data_capacity;
+    bool pending;
+} CSVHeldRow;
+
+typedef struct {
+    CSVBuffer input;
     CSVConfig *config;
+    CSVParser *parser;
     Arena *persistent_arena;
     Arena *temp_arena;
     bool headers_loaded;
     int cached_header_count;
     char **cached_headers;
+    CSVHeaderMap header_map;
     long line_number;
     CSVRecord *current_record;
     bool owns_arenas;
+    CSVRecordIndex index;
+    CSVProjection projection;
+    const CSVPredicate *filter;
+    CSVHeldRow held_row;
 } CSVReader;
 
 CSVReader* csv_reader_init_with_config(Arena *persistent_arena, Arena *temp_arena, CSVConfig *config);
 CSVReader* csv_reader_init_standalone(CSVConfig *config);
 void csv_reader_free(CSVReader *reader);
 CSVRecord* csv_reader_next_record(CSVReader *reader);
+CSVRecordView* csv_reader_next_record_view(CSVReader *reader);
+char* csv_reader_view_field_string(CSVReader *reader, const CSVRecordView *record, size_t index);
+
+
+bool csv_record_batch_init(CSVRecordBatch *batch, size_t capacity);
+void csv_record_batch_free(CSVRecordBatch *batch);
+
+/*
+ * Fills batch with up to max_records records (at most its capacity) and
+ * returns how many were read; 0 at end of input. A record that fails to
+ * parse ends the batch early with the records before it and sets
+ * batch->error; later calls return 0 until the caller clears error, which
+ * resumes after the bad record.
+ */
+size_t csv_reader_next_records(CSVReader *reader, CSVRecordBatch *batch, size_t max_records);
 
+/*
+ * Arrow-style string column: value i is data[offsets[i] .. offsets[i + 1]),
+ * unescaped and not NUL-terminated.
+ */
+typedef struct {
+    uint32_t *offsets;
+    char *data;
+    size_t data_size;
+    size_t data_capacity;
+} CSVColumn;
+
+/*
+ * Caller-owned column-major batch. Columns follow the projection when one
+ * is set, otherwise the header row, and short rows contribute empty values
+ * while extra fields are dropped. Without either, the batch is as wide as
+ * its widest row and columns a row adds are empty in the rows before it.
+ * names points at the reader's headers (NULL entries without a header row).
+ * error is set as in CSVRecordBatch.
+ */
+typedef struct {
+    CSVColumn *columns;
+    const char **names;
+    size_t column_count;
+    size_t column_capacity;
+    size_t row_count;
+    size_t row_capacity;
+    const char *error;
+    int error_line;
+    int error_column;
+} CSVColumnBatch;
+
+bool csv_column_batch_init(CSVColumnBatch *batch, size_t row_capacity);
+void csv_column_batch_free(CSVColumnBatch *batch);
+const char* csv_column_batch_value(const CSVColumnBatch *batch, size_t column, size_t row, size_t *length);
+
+/*
+ * Fills batch with up to max_rows rows (at most its row capacity) using the
+ * reader's projection and filter; returns the row count, 0 at end of input.
+ * A row that would push a column past 4 GiB ends the batch early and starts
+ * the next one. A row that fails to parse, runs out of memory, or holds a
+ * value over 4 GiB on its own ends the batch and sets batch->error; later
+ * calls return 0 until the caller clears error. Only a row that could not
+ * be stored for lack of memory is retried then; the others are skipped.
+ */
+size_t csv_reader_next_column_batch(CSVReader *reader, CSVColumnBatch *batch, size_t max_rows);
 
 void csv_reader_rewind(CSVReader *reader);
 int csv_reader_set_config(CSVReader *reader, Arena *persistent_arena, Arena *temp_arena, const CSVConfig *config);
@@ -36,5 +138,36 @@ long csv_reader_get_position(CSVReader *reader);
 char** csv_reader_get_headers(CSVReader *reader, int *header_count);
 int csv_reader_seek(CSVReader *reader, long position);
 int csv_reader_has_next(CSVReader *reader);
+int csv_reader_build_index(CSVReader *reader);
+
+/* Header lookups go through a hash map built when the header row is read. */
+int csv_reader_column_index(CSVReader *reader, const char *name);
+
+/*
+ * Field of record (from this reader) in the named column, honouring any
+ * projection. NULL when the column is unknown, not projected, or missing
+ * from a short row.
+ */
+char* csv_reader_get_field(CSVReader *reader, const CSVRecord *record, const char *name);
+
+/*
+ * Restricts next_record and next_record_view to the given columns, in the
+ * given order. Names are resolved against the header row. Unselected fields
+ * are skipped without being copied. A count of 0 clears the projection.
+ */
+int csv_reader_set_projection(CSVReader *reader, const char **names, size_t count);
+int csv_reader_set_projection_indices(CSVReader *reader, const int *indices, size_t count);
+void csv_reader_clear_projection(CSVReader *reader);
+
+/*
+ * Rows the predicate rejects are skipped inside next_record and
+ * next_record_view before any field is copied; only the columns the
+ * predicate reads are split to decide. Positions, seeks and record counts
+ * still refer to unfiltered rows. NULL removes the filter.
+ */
+int csv_reader_set_filter(CSVReader *reader, const CSVPredicate *predicate);
+
+/* Returns false when input is read inline, without read-ahead or io_uring. */
+bool csv_reader_get_read_ahead_stats(CSVReader *reader, CSVReadAheadStats *stats);
 
 #endif 
@@ -0,0 +1,159 @@
+#include "csv_simd.h"
+#include <pthread.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && defined(__SSE2__)
+#define CSV_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+typedef void (*IndexBlockFn)(const char *block, char delimiter, char enclosure, CSVStructuralMasks *masks);
+
+static void index_block_scalar(const char *block, char delimiter, char enclosure, CSVStructuralMasks *masks) {
+    uint64_t delim_bits = 0;
+    uint64_t quote_bits = 0;
+    uint64_t newline_bits = 0;
+
+    for (int i = 0; i < CSV_SIMD_BLOCK_SIZE; i++) {
+        char c = block[i];
+        delim_bits |= (uint64_t)(c == delimiter) << i;
+        quote_bits |= (uint64_t)(c == enclosure) << i;
+        newline_bits |= (uint64_t)(c == '\n' || c == '\r') << i;
+    }
+
+    masks->delimiter = delim_bits;
+    masks->enclosure = quote_bits;
+    masks->newline = newline_bits;
+}
+
+#ifdef CSV_SIMD_X86
+static void index_block_sse2(const char *block, char delimiter, char enclosure, CSVStructuralMasks *masks) {
+    const __m128i delim = _mm_set1_epi8(delimiter);
+    const __m128i quote = _mm_set1_epi8(enclosure);
+    const __m128i lf = _mm_set1_epi8('\n');
+    const __m128i cr = _mm_set1_epi8('\r');
+    uint64_t delim_bits = 0;
+    uint64_t quote_bits = 0;
+    uint64_t newline_bits = 0;
+
+    for (int i = 0; i < CSV_SIMD_BLOCK_SIZE; i += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(block + i));
+        __m128i eol = _mm_or_si128(_mm_cmpeq_epi8(chunk, lf), _mm_cmpeq_epi8(chunk, cr));
+        delim_bits |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, delim)) << i;
+        quote_bits |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, quote)) << i;
+        newline_bits |= (uint64_t)(uint16_t)_mm_movemask_epi8(eol) << i;
+    }
+
+    masks->delimiter = delim_bits;
+    masks->enclosure = quote_bits;
+    masks->newline = newline_bits;
+}
+
+__attribute__((target("avx2")))
+static void index_block_avx2(const char *block, char delimiter, char enclosure, CSVStructuralMasks *masks) {
+    const __m256i delim = _mm256_set1_epi8(delimiter);
+    const __m256i quote = _mm256_set1_epi8(enclosure);
+    const __m256i lf = _mm256_set1_epi8('\n');
+    const __m256i cr = _mm256_set1_epi8('\r');
+
+    __m256i lo = _mm256_loadu_si256((const __m256i*)block);
+    __m256i hi = _mm256_loadu_si256((const __m256i*)(block + 32));
+
+    uint64_t delim_lo = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, delim));
+    uint64_t delim_hi = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, delim));
+    uint64_t quote_lo = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, quote));
+    uint64_t quote_hi = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, quote));
+    uint64_t eol_lo = (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(lo, lf), _mm256_cmpeq_epi8(lo, cr)));
+    uint64_t eol_hi = (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(hi, lf), _mm256_cmpeq_epi8(hi, cr)));
+
+    masks->delimiter = delim_lo | (delim_hi << 32);
+    masks->enclosure = quote_lo | (quote_hi << 32);
+    masks->newline = eol_lo | (eol_hi << 32);
+}
+#endif
+
+/*
+ * The level is detected once through pthread_once; the active kernel and
+ * level are then read and replaced atomically, so readers on any number of
+ * threads can index their first block at the same time.
+ */
+static pthread_once_t init_once = PTHREAD_ONCE_INIT;
+static CSVSimdLevel detected_level = CSV_SIMD_SCALAR;
+static CSVSimdLevel active_level = CSV_SIMD_DISABLED;
+static IndexBlockFn active_index_block = NULL;
+
+static CSVSimdLevel detect_level(void) {
+#ifdef CSV_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return CSV_SIMD_AVX2;
+    return CSV_SIMD_SSE2;
+#else
+    return CSV_SIMD_SCALAR;
+#endif
+}
+
+static IndexBlockFn index_fn_for_level(CSVSimdLevel level) {
+    switch (level) {
+#ifdef CSV_SIMD_X86
+        case CSV_SIMD_AVX2: return index_block_avx2;
+        case CSV_SIMD_SSE2: return index_block_sse2;
+#endif
+        default: return index_block_scalar;
+    }
+}
+
+static void store_level(CSVSimdLevel level) {
+    __atomic_store_n(&active_level, level, __ATOMIC_RELEASE);
+    __atomic_store_n(&active_index_block, index_fn_for_level(level), __ATOMIC_RELEASE);
+}
+
+static void init_levels(void) {
+    detected_level = detect_level();
+    store_level(detected_level > CSV_SIMD_SCALAR ? detected_level : CSV_SIMD_DISABLED);
+}
+
+CSVSimdLevel csv_simd_detect_level(void) {
+    pthread_once(&init_once, init_levels);
+    return detected_level;
+}
+
+CSVSimdLevel csv_simd_set_level(CSVSimdLevel level) {
+    CSVSimdLevel supported = csv_simd_detect_level();
+    if (level > supported) level = supported;
+
+    store_level(level);
+    return level;
+}
+
+CSVSimdLevel csv_simd_get_level(void) {
+    pthread_once(&init_once, init_levels);
+    return __atomic_load_n(&active_level, __ATOMIC_ACQUIRE);
+}
+
+const char* csv_simd_level_string(CSVSimdLevel level) {
+    switch (level) {
+        case CSV_SIMD_DISABLED: return "disabled";
+        case CSV_SIMD_SCALAR: return "scalar";
+        case CSV_SIMD_SSE2: return "sse2";
+        case CSV_SIMD_AVX2: return "avx2";
+        default: return "unknown";
+    }
+}
+
+void csv_simd_index_block(const char *block, char delimiter, char enclosure, CSVStructuralMasks *masks) {
+    IndexBlockFn index_block = __atomic_load_n(&active_index_block, __ATOMIC_ACQUIRE);
+    if (!index_block) {
+        pthread_once(&init_once, init_levels);
+        index_block = __atomic_load_n(&active_index_block, __ATOMIC_ACQUIRE);
+    }
+    index_block(block, delimiter, enclosure, masks);
+}
+
+uint64_t csv_simd_prefix_xor(uint64_t bits) {
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
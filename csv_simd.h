@@ -0,0 +1,31 @@
+#ifndef CSV_SIMD_H
+#define CSV_SIMD_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define CSV_SIMD_BLOCK_SIZE 64
+
+typedef enum {
+    CSV_SIMD_DISABLED = 0,
+    CSV_SIMD_SCALAR,
+    CSV_SIMD_SSE2,
+    CSV_SIMD_AVX2
+} CSVSimdLevel;
+
+typedef struct {
+    uint64_t delimiter;
+    uint64_t enclosure;
+    uint64_t newline;
+} CSVStructuralMasks;
+
+void csv_simd_index_block(const char *block, char delimiter, char enclosure, CSVStructuralMasks *masks);
+uint64_t csv_simd_prefix_xor(uint64_t bits);
+
+CSVSimdLevel csv_simd_detect_level(void);
+CSVSimdLevel csv_simd_get_level(void);
+CSVSimdLevel csv_simd_set_level(CSVSimdLevel level);
+const char* csv_simd_level_string(CSVSimdLevel level);
+
+#endif
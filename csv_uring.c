@@ -0,0 +1,454 @@
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE
+
+#include "csv_uring.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define CSV_HAVE_IO_URING 1
+#endif
+#endif
+
+const char* csv_uring_error_string(CSVUringResult result) {
+    switch (result) {
+        case CSV_URING_OK: return "Success";
+        case CSV_URING_ERROR_NULL_POINTER: return "Null pointer error";
+        case CSV_URING_ERROR_MEMORY_ALLOCATION: return "Memory allocation failed";
+        case CSV_URING_ERROR_UNSUPPORTED: return "io_uring is not available for this file";
+        case CSV_URING_ERROR_FILE_READ: return "Failed to read from file";
+        case CSV_URING_ERROR_FILE_SEEK: return "Failed to seek in file";
+        default: return "Unknown error";
+    }
+}
+
+#ifdef CSV_HAVE_IO_URING
+
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+
+typedef enum {
+    SLOT_FREE,
+    SLOT_IN_FLIGHT,
+    SLOT_READY
+} UringSlotState;
+
+typedef struct {
+    char *data;
+    off_t offset;
+    int result;
+    UringSlotState state;
+    struct iovec iov;
+} UringSlot;
+
+struct CSVUring {
+    int ring_fd;
+    int fd;
+    void *sq_ring;
+    size_t sq_ring_size;
+    void *cq_ring;
+    size_t cq_ring_size;
+    struct io_uring_sqe *sqes;
+    size_t sqes_size;
+    unsigned *sq_tail;
+    unsigned *sq_mask;
+    unsigned *sq_array;
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned *cq_mask;
+    struct io_uring_cqe *cqes;
+    unsigned to_submit;
+    UringSlot *slots;
+    int slot_count;
+    size_t slot_size;
+    bool registered;
+    int head;
+    size_t consumed;
+    int in_flight;
+    off_t next_offset;
+    bool failed;
+    CSVReadAheadStats stats;
+};
+
+static int ring_setup(unsigned entries, struct io_uring_params *params) {
+    return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int ring_enter(int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+    return (int)syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, NULL, 0);
+}
+
+static int ring_register(int ring_fd, unsigned opcode, const void *arg, unsigned count) {
+    return (int)syscall(__NR_io_uring_register, ring_fd, opcode, arg, count);
+}
+
+static void queue_read(CSVUring *uring, int index) {
+    UringSlot *slot = &uring->slots[index];
+    unsigned tail = *uring->sq_tail;
+    unsigned sq_index = tail & *uring->sq_mask;
+    struct io_uring_sqe *sqe = &uring->sqes[sq_index];
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->fd = uring->fd;
+    sqe->off = (unsigned long long)slot->offset;
+    sqe->user_data = (unsigned long long)index;
+    if (uring->registered) {
+        sqe->opcode = IORING_OP_READ_FIXED;
+        sqe->addr = (unsigned long long)(uintptr_t)slot->data;
+        sqe->len = (unsigned)uring->slot_size;
+        sqe->buf_index = (unsigned short)index;
+    } else {
+        slot->iov.iov_base = slot->data;
+        slot->iov.iov_len = uring->slot_size;
+        sqe->opcode = IORING_OP_READV;
+        sqe->addr = (unsigned long long)(uintptr_t)&slot->iov;
+        sqe->len = 1;
+    }
+
+    uring->sq_array[sq_index] = sq_index;
+    __atomic_store_n(uring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    uring->to_submit++;
+    slot->state = SLOT_IN_FLIGHT;
+    uring->in_flight++;
+}
+
+static void submit_slot(CSVUring *uring, int index) {
+    uring->slots[index].offset = uring->next_offset;
+    uring->next_offset += (off_t)uring->slot_size;
+    queue_read(uring, index);
+}
+
+static void reap_completions(CSVUring *uring) {
+    unsigned head = *uring->cq_head;
+    unsigned tail = __atomic_load_n(uring->cq_tail, __ATOMIC_ACQUIRE);
+
+    while (head != tail) {
+        struct io_uring_cqe *cqe = &uring->cqes[head & *uring->cq_mask];
+        UringSlot *slot = &uring->slots[cqe->user_data];
+        slot->result = cqe->res;
+        slot->state = SLOT_READY;
+        uring->in_flight--;
+        if (cqe->res > 0) {
+            uring->stats.bytes_read += (uint64_t)cqe->res;
+            uring->stats.buffers_filled++;
+        }
+        head++;
+    }
+    __atomic_store_n(uring->cq_head, head, __ATOMIC_RELEASE);
+}
+
+/* Submits whatever is queued and, when wait is set, blocks for one completion. */
+static bool enter_ring(CSVUring *uring, bool wait) {
+    for (;;) {
+        unsigned flags = wait ? IORING_ENTER_GETEVENTS : 0;
+        int submitted = ring_enter(uring->ring_fd, uring->to_submit, wait ? 1 : 0, flags);
+        if (submitted >= 0) {
+            uring->to_submit -= (unsigned)submitted;
+            reap_completions(uring);
+            return true;
+        }
+        if (errno != EINTR && errno != EAGAIN && errno != EBUSY) return false;
+        reap_completions(uring);
+        if (!wait) return true;
+    }
+}
+
+static bool drain_ring(CSVUring *uring) {
+    while (uring->in_flight > 0) {
+        if (!enter_ring(uring, true)) return false;
+    }
+    return true;
+}
+
+static bool restart_at(CSVUring *uring, off_t offset) {
+    if (!drain_ring(uring)) return false;
+
+    uring->head = 0;
+    uring->consumed = 0;
+    uring->next_offset = offset;
+    for (int i = 0; i < uring->slot_count; i++) {
+        submit_slot(uring, i);
+    }
+    return enter_ring(uring, false);
+}
+
+static void release_ring(CSVUring *uring) {
+    if (uring->sqes) munmap(uring->sqes, uring->sqes_size);
+    if (uring->cq_ring && uring->cq_ring != uring->sq_ring) munmap(uring->cq_ring, uring->cq_ring_size);
+    if (uring->sq_ring) munmap(uring->sq_ring, uring->sq_ring_size);
+    if (uring->ring_fd >= 0) close(uring->ring_fd);
+    if (uring->slots) {
+        for (int i = 0; i < uring->slot_count; i++) {
+            free(uring->slots[i].data);
+        }
+    }
+    free(uring->slots);
+    free(uring);
+}
+
+static bool map_ring(CSVUring *uring, const struct io_uring_params *params) {
+    uring->sq_ring_size = params->sq_off.array + params->sq_entries * sizeof(unsigned);
+    uring->cq_ring_size = params->cq_off.cqes + params->cq_entries * sizeof(struct io_uring_cqe);
+    bool single_mmap = (params->features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap && uring->cq_ring_size > uring->sq_ring_size) {
+        uring->sq_ring_size = uring->cq_ring_size;
+    }
+
+    void *sq_ring = mmap(NULL, uring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                         uring->ring_fd, IORING_OFF_SQ_RING);
+    if (sq_ring == MAP_FAILED) return false;
+    uring->sq_ring = sq_ring;
+
+    if (single_mmap) {
+        uring->cq_ring = sq_ring;
+    } else {
+        void *cq_ring = mmap(NULL, uring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                             uring->ring_fd, IORING_OFF_CQ_RING);
+        if (cq_ring == MAP_FAILED) return false;
+        uring->cq_ring = cq_ring;
+    }
+
+    uring->sqes_size = params->sq_entries * sizeof(struct io_uring_sqe);
+    void *sqes = mmap(NULL, uring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                      uring->ring_fd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) return false;
+    uring->sqes = sqes;
+
+    char *sq = uring->sq_ring;
+    char *cq = uring->cq_ring;
+    uring->sq_tail = (unsigned*)(sq + params->sq_off.tail);
+    uring->sq_mask = (unsigned*)(sq + params->sq_off.ring_mask);
+    uring->sq_array = (unsigned*)(sq + params->sq_off.array);
+    uring->cq_head = (unsigned*)(cq + params->cq_off.head);
+    uring->cq_tail = (unsigned*)(cq + params->cq_off.tail);
+    uring->cq_mask = (unsigned*)(cq + params->cq_off.ring_mask);
+    uring->cqes = (struct io_uring_cqe*)(cq + params->cq_off.cqes);
+    return true;
+}
+
+static void register_buffers(CSVUring *uring) {
+    struct iovec *iovecs = calloc((size_t)uring->slot_count, sizeof(struct iovec));
+    if (!iovecs) return;
+
+    for (int i = 0; i < uring->slot_count; i++) {
+        iovecs[i].iov_base = uring->slots[i].data;
+        iovecs[i].iov_len = uring->slot_size;
+    }
+    /* Registration pins memory and can hit RLIMIT_MEMLOCK; plain READV still works. */
+    uring->registered = ring_register(uring->ring_fd, IORING_REGISTER_BUFFERS, iovecs,
+                                      (unsigned)uring->slot_count) == 0;
+    free(iovecs);
+}
+
+CSVUringResult csv_uring_open(CSVUring **uring, int fd, off_t offset, int queue_depth, size_t buffer_size) {
+    if (!uring || fd < 0) return CSV_URING_ERROR_NULL_POINTER;
+    *uring = NULL;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) return CSV_URING_ERROR_UNSUPPORTED;
+
+    if (queue_depth <= 0) queue_depth = CSV_URING_DEFAULT_QUEUE_DEPTH;
+    if (queue_depth > CSV_URING_MAX_QUEUE_DEPTH) queue_depth = CSV_URING_MAX_QUEUE_DEPTH;
+    if (buffer_size == 0) buffer_size = CSV_URING_DEFAULT_BUFFER_SIZE;
+    if (buffer_size > 0x7ffff000) buffer_size = 0x7ffff000;
+
+    CSVUring *created = calloc(1, sizeof(CSVUring));
+    if (!created) return CSV_URING_ERROR_MEMORY_ALLOCATION;
+    created->fd = fd;
+    created->slot_count = queue_depth;
+    created->slot_size = buffer_size;
+
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    created->ring_fd = ring_setup((unsigned)queue_depth, &params);
+    if (created->ring_fd < 0) {
+        free(created);
+        return CSV_URING_ERROR_UNSUPPORTED;
+    }
+    if (!map_ring(created, &params)) {
+        release_ring(created);
+        return CSV_URING_ERROR_UNSUPPORTED;
+    }
+
+    created->slots = calloc((size_t)queue_depth, sizeof(UringSlot));
+    if (!created->slots) {
+        release_ring(created);
+        return CSV_URING_ERROR_MEMORY_ALLOCATION;
+    }
+    for (int i = 0; i < queue_depth; i++) {
+        void *data = NULL;
+        if (posix_memalign(&data, 4096, buffer_size) != 0) {
+            release_ring(created);
+            return CSV_URING_ERROR_MEMORY_ALLOCATION;
+        }
+        created->slots[i].data = data;
+    }
+
+    register_buffers(created);
+    if (!restart_at(created, offset)) {
+        drain_ring(created);
+        release_ring(created);
+        return CSV_URING_ERROR_UNSUPPORTED;
+    }
+
+    *uring = created;
+    return CSV_URING_OK;
+}
+
+/*
+ * Slots are consumed and resubmitted in index order, so the head slot always
+ * holds the bytes that come next. A short read that is not end of file would
+ * leave a gap before the reads already queued behind it, so the ring is
+ * drained and restarted right after it.
+ */
+ssize_t csv_uring_read(CSVUring *uring, char *dest, size_t capacity) {
+    if (!uring || !dest) return -1;
+    if (uring->failed) return -1;
+    if (capacity == 0) return 0;
+
+    for (;;) {
+        UringSlot *slot = &uring->slots[uring->head];
+        if (slot->state == SLOT_IN_FLIGHT) {
+            reap_completions(uring);
+            if (slot->state == SLOT_IN_FLIGHT) uring->stats.consumer_stalls++;
+            while (slot->state == SLOT_IN_FLIGHT) {
+                if (!enter_ring(uring, true)) {
+                    uring->failed = true;
+                    return -1;
+                }
+            }
+        }
+        if (slot->state == SLOT_FREE) return 0;
+
+        if (slot->result == -EINTR || slot->result == -EAGAIN) {
+            queue_read(uring, uring->head);
+            if (!enter_ring(uring, false)) {
+                uring->failed = true;
+                return -1;
+            }
+            continue;
+        }
+        if (slot->result < 0) {
+            uring->failed = true;
+            return -1;
+        }
+        if (slot->result == 0) return 0;
+        break;
+    }
+
+    UringSlot *slot = &uring->slots[uring->head];
+    size_t length = (size_t)slot->result;
+    size_t n = length - uring->consumed;
+    if (n > capacity) n = capacity;
+    memcpy(dest, slot->data + uring->consumed, n);
+    uring->consumed += n;
+
+    if (uring->consumed == length) {
+        int index = uring->head;
+        uring->consumed = 0;
+        uring->head = (uring->head + 1) % uring->slot_count;
+        slot->state = SLOT_FREE;
+
+        bool ok;
+        if (length < uring->slot_size) {
+            ok = restart_at(uring, slot->offset + (off_t)length);
+        } else {
+            submit_slot(uring, index);
+            ok = enter_ring(uring, false);
+        }
+        if (!ok) uring->failed = true;
+    }
+    return (ssize_t)n;
+}
+
+CSVUringResult csv_uring_seek(CSVUring *uring, off_t offset) {
+    if (!uring) return CSV_URING_ERROR_NULL_POINTER;
+    if (offset < 0) return CSV_URING_ERROR_FILE_SEEK;
+
+    uring->failed = false;
+    if (!restart_at(uring, offset)) {
+        uring->failed = true;
+        return CSV_URING_ERROR_FILE_SEEK;
+    }
+    return CSV_URING_OK;
+}
+
+void csv_uring_get_stats(CSVUring *uring, CSVReadAheadStats *stats) {
+    if (!stats) return;
+    memset(stats, 0, sizeof(CSVReadAheadStats));
+    if (uring) *stats = uring->stats;
+}
+
+bool csv_uring_uses_registered_buffers(CSVUring *uring) {
+    return uring ? uring->registered : false;
+}
+
+void csv_uring_close(CSVUring *uring) {
+    if (!uring) return;
+
+    /* The kernel may still be writing into the slots; wait before freeing them. */
+    drain_ring(uring);
+    release_ring(uring);
+}
+
+bool csv_uring_available(void) {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    int ring_fd = ring_setup(1, &params);
+    if (ring_fd < 0) return false;
+    close(ring_fd);
+    return true;
+}
+
+#else
+
+struct CSVUring {
+    int unused;
+};
+
+CSVUringResult csv_uring_open(CSVUring **uring, int fd, off_t offset, int queue_depth, size_t buffer_size) {
+    (void)offset;
+    (void)queue_depth;
+    (void)buffer_size;
+    if (!uring || fd < 0) return CSV_URING_ERROR_NULL_POINTER;
+    *uring = NULL;
+    return CSV_URING_ERROR_UNSUPPORTED;
+}
+
+ssize_t csv_uring_read(CSVUring *uring, char *dest, size_t capacity) {
+    (void)uring;
+    (void)dest;
+    (void)capacity;
+    return -1;
+}
+
+CSVUringResult csv_uring_seek(CSVUring *uring, off_t offset) {
+    (void)offset;
+    return uring ? CSV_URING_ERROR_UNSUPPORTED : CSV_URING_ERROR_NULL_POINTER;
+}
+
+void csv_uring_get_stats(CSVUring *uring, CSVReadAheadStats *stats) {
+    (void)uring;
+    if (stats) memset(stats, 0, sizeof(CSVReadAheadStats));
+}
+
+bool csv_uring_uses_registered_buffers(CSVUring *uring) {
+    (void)uring;
+    return false;
+}
+
+void csv_uring_close(CSVUring *uring) {
+    (void)uring;
+}
+
+bool csv_uring_available(void) {
+    return false;
+}
+
+#endif
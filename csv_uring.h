@@ -0,0 +1,48 @@
+#ifndef CSV_URING_H
+#define CSV_URING_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <sys/types.h>
+#include "csv_readahead.h"
+
+#define CSV_URING_DEFAULT_QUEUE_DEPTH 8
+#define CSV_URING_DEFAULT_BUFFER_SIZE (256 * 1024)
+#define CSV_URING_MAX_QUEUE_DEPTH 64
+
+typedef enum {
+    CSV_URING_OK = 0,
+    CSV_URING_ERROR_NULL_POINTER,
+    CSV_URING_ERROR_MEMORY_ALLOCATION,
+    CSV_URING_ERROR_UNSUPPORTED,
+    CSV_URING_ERROR_FILE_READ,
+    CSV_URING_ERROR_FILE_SEEK
+} CSVUringResult;
+
+typedef struct CSVUring CSVUring;
+
+/*
+ * Keeps queue_depth reads of buffer_size bytes in flight on a regular file,
+ * starting at offset. Buffers are registered with the ring when the kernel
+ * allows it. Returns CSV_URING_ERROR_UNSUPPORTED when io_uring is missing,
+ * blocked, or fd is not a regular file; callers then fall back to read(2).
+ */
+CSVUringResult csv_uring_open(CSVUring **uring, int fd, off_t offset, int queue_depth, size_t buffer_size);
+
+/* Same contract as read(2): bytes copied, 0 at end of file, -1 on error. */
+ssize_t csv_uring_read(CSVUring *uring, char *dest, size_t capacity);
+
+/* Waits out the reads in flight and restarts them at offset. */
+CSVUringResult csv_uring_seek(CSVUring *uring, off_t offset);
+
+/* consumer_stalls counts reads that waited on a completion; producer_stalls is unused. */
+void csv_uring_get_stats(CSVUring *uring, CSVReadAheadStats *stats);
+bool csv_uring_uses_registered_buffers(CSVUring *uring);
+void csv_uring_close(CSVUring *uring);
+
+/* True when this build and kernel can set up a ring. */
+bool csv_uring_available(void);
+
+const char* csv_uring_error_string(CSVUringResult result);
+
+#endif
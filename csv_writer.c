@@ -1,6 +1,13 @@
+#define _POSIX_C_SOURCE 200809L
+
 #include "csv_writer.h"
 #include "csv_utils.h"
+#include <stdlib.h>
 #include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
 
 static const unsigned char UTF8_BOM[] = {0xEF, 0xBB, 0xBF};
 static const unsigned char UTF16LE_BOM[] = {0xFF, 0xFE};
@@ -23,7 +30,366 @@ const char* csv_writer_error_string(CSVWriterResult result) {
     }
 }
 
-static CSVWriterResult write_bom(FILE *file, CSVEncoding encoding) {
+static uint64_t monotonic_ms(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000 + (uint64_t)now.tv_nsec / 1000000;
+}
+
+static size_t write_all(int fd, const char *data, size_t length) {
+    size_t written = 0;
+    while (written < length) {
+        ssize_t n = write(fd, data + written, length - written);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        written += (size_t)n;
+    }
+    return written;
+}
+
+struct CSVWriterAsync {
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    int fd;
+    char *buffers[2];
+    const char *pending;
+    size_t pending_length;
+    bool busy;
+    bool stop;
+    int error;
+};
+
+/*
+ * The background thread owns at most one filled buffer at a time while
+ * the caller formats into the other, so a slow disk stalls the caller
+ * only once both buffers are full. The first write error is sticky.
+ */
+static void* async_writer_main(void *arg) {
+    CSVWriterAsync *async = arg;
+
+    pthread_mutex_lock(&async->mutex);
+    for (;;) {
+        while (!async->busy && !async->stop) {
+            pthread_cond_wait(&async->cond, &async->mutex);
+        }
+        if (!async->busy) break;
+
+        const char *data = async->pending;
+        size_t length = async->pending_length;
+        pthread_mutex_unlock(&async->mutex);
+
+        bool failed = write_all(async->fd, data, length) != length;
+
+        pthread_mutex_lock(&async->mutex);
+        if (failed && async->error == CSV_WRITER_OK) {
+            __atomic_store_n(&async->error, CSV_WRITER_ERROR_FILE_WRITE, __ATOMIC_RELEASE);
+        }
+        async->busy = false;
+        pthread_cond_broadcast(&async->cond);
+    }
+    pthread_mutex_unlock(&async->mutex);
+    return NULL;
+}
+
+static CSVWriterResult async_error(const CSVWriter *writer) {
+    if (!writer->async) return CSV_WRITER_OK;
+    return (CSVWriterResult)__atomic_load_n(&writer->async->error, __ATOMIC_ACQUIRE);
+}
+
+/* Hands the filled buffer to the thread, waiting for the previous one unless only_if_idle. */
+static CSVWriterResult handoff_async(CSVWriter *writer, bool only_if_idle) {
+    CSVWriterAsync *async = writer->async;
+
+    pthread_mutex_lock(&async->mutex);
+    if (only_if_idle && async->busy) {
+        CSVWriterResult result = (CSVWriterResult)async->error;
+        pthread_mutex_unlock(&async->mutex);
+        return result;
+    }
+    while (async->busy) {
+        pthread_cond_wait(&async->cond, &async->mutex);
+    }
+    CSVWriterResult result = (CSVWriterResult)async->error;
+    if (result == CSV_WRITER_OK) {
+        async->pending = writer->buffer;
+        async->pending_length = writer->buffer_used;
+        async->busy = true;
+        writer->buffer = (writer->buffer == async->buffers[0]) ? async->buffers[1] : async->buffers[0];
+        writer->buffer_used = 0;
+        writer->handoff_due = false;
+        writer->async_handoffs++;
+        pthread_cond_signal(&async->cond);
+    }
+    pthread_mutex_unlock(&async->mutex);
+    return result;
+}
+
+static CSVWriterResult submit_async(CSVWriter *writer) {
+    return handoff_async(writer, false);
+}
+
+static CSVWriterResult wait_async(CSVWriter *writer) {
+    CSVWriterAsync *async = writer->async;
+
+    pthread_mutex_lock(&async->mutex);
+    while (async->busy) {
+        pthread_cond_wait(&async->cond, &async->mutex);
+    }
+    CSVWriterResult result = (CSVWriterResult)async->error;
+    pthread_mutex_unlock(&async->mutex);
+    return result;
+}
+
+static CSVWriterResult start_async(CSVWriter *writer) {
+    if (fflush(writer->file) != 0) return CSV_WRITER_ERROR_FILE_WRITE;
+
+    int fd = fileno(writer->file);
+    if (fd < 0) return CSV_WRITER_OK;
+
+    CSVWriterAsync *async = calloc(1, sizeof(CSVWriterAsync));
+    if (!async) return CSV_WRITER_ERROR_MEMORY_ALLOCATION;
+    async->buffers[1] = malloc(writer->buffer_size);
+    if (!async->buffers[1]) {
+        free(async);
+        return CSV_WRITER_ERROR_MEMORY_ALLOCATION;
+    }
+    async->buffers[0] = writer->buffer;
+    async->fd = fd;
+    async->error = CSV_WRITER_OK;
+
+    pthread_mutex_init(&async->mutex, NULL);
+    pthread_cond_init(&async->cond, NULL);
+    if (pthread_create(&async->thread, NULL, async_writer_main, async) != 0) {
+        pthread_cond_destroy(&async->cond);
+        pthread_mutex_destroy(&async->mutex);
+        free(async->buffers[1]);
+        free(async);
+        return CSV_WRITER_ERROR_MEMORY_ALLOCATION;
+    }
+
+    writer->async = async;
+    return CSV_WRITER_OK;
+}
+
+/* Waits for the last buffer, joins the thread and frees both buffers. */
+static CSVWriterResult stop_async(CSVWriter *writer) {
+    CSVWriterAsync *async = writer->async;
+    if (!async) return CSV_WRITER_OK;
+
+    pthread_mutex_lock(&async->mutex);
+    async->stop = true;
+    pthread_cond_broadcast(&async->cond);
+    pthread_mutex_unlock(&async->mutex);
+    pthread_join(async->thread, NULL);
+
+    CSVWriterResult result = (CSVWriterResult)async->error;
+    pthread_cond_destroy(&async->cond);
+    pthread_mutex_destroy(&async->mutex);
+    free(async->buffers[0]);
+    free(async->buffers[1]);
+    free(async);
+
+    writer->async = NULL;
+    writer->buffer = NULL;
+    writer->buffer_used = 0;
+    return result;
+}
+
+/*
+ * Records are formatted into the writer's own buffer and handed to the
+ * kernel with write(2) on the stream's descriptor, bypassing stdio. Any
+ * bytes the caller left in the FILE's buffer are flushed first so the
+ * output keeps its order; streams without a descriptor use fwrite. In
+ * async mode the buffer is handed to the writer thread instead.
+ */
+static CSVWriterResult flush_output(CSVWriter *writer) {
+    writer->pending_records = 0;
+    if (csv_config_get_flush_interval_ms(writer->config) > 0) {
+        writer->last_flush_ms = monotonic_ms();
+    }
+    if (writer->buffer_used == 0) return async_error(writer);
+    if (writer->async) return submit_async(writer);
+    if (fflush(writer->file) != 0) return CSV_WRITER_ERROR_FILE_WRITE;
+
+    int fd = fileno(writer->file);
+    if (fd < 0) {
+        if (fwrite(writer->buffer, 1, writer->buffer_used, writer->file) != writer->buffer_used) {
+            return CSV_WRITER_ERROR_FILE_WRITE;
+        }
+        writer->buffer_used = 0;
+        return CSV_WRITER_OK;
+    }
+
+    size_t written = write_all(fd, writer->buffer, writer->buffer_used);
+    if (written < writer->buffer_used) {
+        memmove(writer->buffer, writer->buffer + written, writer->buffer_used - written);
+        writer->buffer_used -= written;
+        return CSV_WRITER_ERROR_FILE_WRITE;
+    }
+
+    writer->buffer_used = 0;
+    return CSV_WRITER_OK;
+}
+
+/* A flush the caller can rely on: drained to the kernel and, if asked, to disk. */
+static CSVWriterResult commit_output(CSVWriter *writer) {
+    CSVWriterResult result = flush_output(writer);
+    if (result == CSV_WRITER_OK && writer->async) result = wait_async(writer);
+    if (result != CSV_WRITER_OK) return result;
+    if (fflush(writer->file) != 0) return CSV_WRITER_ERROR_FILE_WRITE;
+
+    if (csv_config_get_sync_on_flush(writer->config)) {
+        int fd = fileno(writer->file);
+#ifdef __APPLE__
+        int synced = fd >= 0 ? fsync(fd) : 0;
+#else
+        int synced = fd >= 0 ? fdatasync(fd) : 0;
+#endif
+        if (synced != 0 && errno != EINVAL) {
+            return CSV_WRITER_ERROR_FILE_WRITE;
+        }
+    }
+    return CSV_WRITER_OK;
+}
+
+/*
+ * With autoFlush and no thresholds every record is flushed, as before,
+ * except in async mode where the buffer is handed off only when it fills
+ * or on csv_writer_flush. Otherwise the first threshold reached wins; the
+ * interval is checked when a record is written and by csv_writer_poll,
+ * there is no timer.
+ */
+static bool flush_due(CSVWriter *writer) {
+    const CSVConfig *config = writer->config;
+    if (!csv_config_get_auto_flush(config)) return false;
+
+    int records = csv_config_get_flush_records(config);
+    size_t bytes = csv_config_get_flush_bytes(config);
+    int interval_ms = csv_config_get_flush_interval_ms(config);
+    if (records == 0 && bytes == 0 && interval_ms == 0) return !writer->async;
+
+    if (records > 0 && writer->pending_records >= records) return true;
+    if (bytes > 0 && writer->buffer_used >= bytes) return true;
+    if (interval_ms > 0) {
+        uint64_t now = monotonic_ms();
+        if (writer->last_flush_ms == 0) writer->last_flush_ms = now;
+        if (now - writer->last_flush_ms >= (uint64_t)interval_ms) return true;
+    }
+    return false;
+}
+
+static CSVWriterResult emit_bytes(CSVWriter *writer, const char *data, size_t length) {
+    while (length > 0) {
+        size_t room = writer->buffer_size - writer->buffer_used;
+        if (room == 0) {
+            CSVWriterResult result = flush_output(writer);
+            if (result != CSV_WRITER_OK) return result;
+            room = writer->buffer_size - writer->buffer_used;
+        }
+
+        size_t n = length < room ? length : room;
+        memcpy(writer->buffer + writer->buffer_used, data, n);
+        writer->buffer_used += n;
+        data += n;
+        length -= n;
+    }
+    return CSV_WRITER_OK;
+}
+
+static CSVWriterResult emit_char(CSVWriter *writer, char c) {
+    if (writer->buffer_used == writer->buffer_size) {
+        CSVWriterResult result = flush_output(writer);
+        if (result != CSV_WRITER_OK) return result;
+    }
+    writer->buffer[writer->buffer_used++] = c;
+    return CSV_WRITER_OK;
+}
+
+/* Clean fields and the runs between enclosures are copied whole. */
+static CSVWriterResult emit_field(CSVWriter *writer, const char *field) {
+    const char *value = field ? field : "";
+    size_t length = strlen(value);
+
+    if (strcspn(value, writer->quote_chars) == length) {
+        return emit_bytes(writer, value, length);
+    }
+
+    CSVWriterResult result = emit_char(writer, writer->enclosure);
+    const char *p = value;
+    const char *end = value + length;
+    while (result == CSV_WRITER_OK && p < end) {
+        const char *q = memchr(p, writer->enclosure, end - p);
+        if (!q) {
+            result = emit_bytes(writer, p, end - p);
+            break;
+        }
+        result = emit_bytes(writer, p, q - p + 1);
+        if (result == CSV_WRITER_OK) result = emit_char(writer, writer->enclosure);
+        p = q + 1;
+    }
+    if (result != CSV_WRITER_OK) return result;
+    return emit_char(writer, writer->enclosure);
+}
+
+static CSVWriterResult emit_record(CSVWriter *writer, char **fields, int field_count) {
+    for (int i = 0; i < field_count; i++) {
+        if (i > 0) {
+            CSVWriterResult result = emit_char(writer, writer->delimiter);
+            if (result != CSV_WRITER_OK) return result;
+        }
+        CSVWriterResult result = emit_field(writer, fields[i]);
+        if (result != CSV_WRITER_OK) return result;
+    }
+
+    CSVWriterResult result = emit_char(writer, '\n');
+    if (result != CSV_WRITER_OK) return result;
+
+    writer->pending_records++;
+    if (flush_due(writer)) {
+        if (!writer->async || csv_config_get_sync_on_flush(writer->config)) {
+            return commit_output(writer);
+        }
+        /* A threshold only marks the handoff as due, so formatting never waits on the thread. */
+        writer->pending_records = 0;
+        if (csv_config_get_flush_interval_ms(writer->config) > 0) {
+            writer->last_flush_ms = monotonic_ms();
+        }
+        writer->handoff_due = true;
+    }
+    return writer->handoff_due ? handoff_async(writer, true) : CSV_WRITER_OK;
+}
+
+static CSVWriterResult init_output(CSVWriter *writer) {
+    writer->delimiter = csv_config_get_delimiter(writer->config);
+    writer->enclosure = csv_config_get_enclosure(writer->config);
+    writer->escape = csv_config_get_escape(writer->config);
+
+    size_t n = 0;
+    if (writer->delimiter) writer->quote_chars[n++] = writer->delimiter;
+    if (writer->enclosure) writer->quote_chars[n++] = writer->enclosure;
+    writer->quote_chars[n++] = '\n';
+    writer->quote_chars[n++] = '\r';
+    if (csv_config_get_strict_mode(writer->config)) writer->quote_chars[n++] = ' ';
+    writer->quote_chars[n] = '\0';
+
+    /* A flushBytes threshold larger than the default buffer gets a buffer that holds it. */
+    size_t buffer_size = CSV_WRITER_BUFFER_SIZE;
+    if (csv_config_get_flush_bytes(writer->config) > buffer_size) {
+        buffer_size = csv_config_get_flush_bytes(writer->config);
+    }
+    writer->buffer = malloc(buffer_size);
+    if (!writer->buffer) return CSV_WRITER_ERROR_MEMORY_ALLOCATION;
+    writer->buffer_size = buffer_size;
+    writer->buffer_used = 0;
+
+    if (csv_config_get_async_write(writer->config)) {
+        return start_async(writer);
+    }
+    return CSV_WRITER_OK;
+}
+
+static CSVWriterResult write_bom(CSVWriter *writer, CSVEncoding encoding) {
     const unsigned char *bom = NULL;
     size_t bom_size = 0;
     
@@ -55,11 +421,7 @@ static CSVWriterResult write_bom(FILE *file, CSVEncoding encoding) {
             return CSV_WRITER_OK;
     }
     
-    if (bom && fwrite(bom, 1, bom_size, file) != bom_size) {
-        return CSV_WRITER_ERROR_FILE_WRITE;
-    }
-    
-    return CSV_WRITER_OK;
+    return emit_bytes(writer, (const char*)bom, bom_size);
 }
 
 static CSVWriterResult validate_writer_params(CSVWriter **writer, CSVConfig *config, Arena *arena) {
@@ -107,6 +469,44 @@ static CSVWriterResult copy_headers_to_arena(CSVWriter *writer, char **headers,
     }
     
     writer->header_count = header_count;
+    if (!csv_header_map_build(&writer->header_map, writer->headers, header_count, writer->arena)) {
+        return CSV_WRITER_ERROR_MEMORY_ALLOCATION;
+    }
+
+    result = arena_alloc(writer->arena, header_count * sizeof(char*), &ptr);
+    if (result != ARENA_OK) return CSV_WRITER_ERROR_MEMORY_ALLOCATION;
+    writer->ordered_fields = (char**)ptr;
+    return CSV_WRITER_OK;
+}
+
+static void discard_writer(CSVWriter *writer) {
+    if (writer->async) {
+        writer->buffer_used = 0;
+        stop_async(writer);
+    }
+    free(writer->buffer);
+    writer->buffer = NULL;
+    if (writer->owns_config) csv_config_free(writer->config);
+    if (writer->owns_file) fclose(writer->file);
+}
+
+static CSVWriterResult start_output(CSVWriter *writer, char **headers, int header_count) {
+    CSVWriterResult result = init_output(writer);
+    if (result != CSV_WRITER_OK) return result;
+    
+    if (csv_config_get_write_bom(writer->config)) {
+        result = write_bom(writer, csv_config_get_encoding(writer->config));
+        if (result != CSV_WRITER_OK) return result;
+    }
+    
+    result = copy_headers_to_arena(writer, headers, header_count);
+    if (result != CSV_WRITER_OK) return result;
+    
+    if (header_count > 0) {
+        result = write_headers(writer, headers, header_count);
+        if (result != CSV_WRITER_OK) return result;
+    }
+    
     return CSV_WRITER_OK;
 }
 
@@ -129,35 +529,12 @@ CSVWriterResult csv_writer_init(CSVWriter **writer, CSVConfig *config, char **he
     }
     (*writer)->owns_config = true;
     
-    (*writer)->delimiter = csv_config_get_delimiter((*writer)->config);
-    (*writer)->enclosure = csv_config_get_enclosure((*writer)->config);
-    (*writer)->escape = csv_config_get_escape((*writer)->config);
-    
-    if (csv_config_get_write_bom((*writer)->config)) {
-        result = write_bom((*writer)->file, csv_config_get_encoding((*writer)->config));
-        if (result != CSV_WRITER_OK) {
-            if ((*writer)->owns_config) csv_config_free((*writer)->config);
-            fclose((*writer)->file);
-            return result;
-        }
-    }
-    
-    result = copy_headers_to_arena(*writer, headers, header_count);
+    result = start_output(*writer, headers, header_count);
     if (result != CSV_WRITER_OK) {
-        if ((*writer)->owns_config) csv_config_free((*writer)->config);
-        fclose((*writer)->file);
+        discard_writer(*writer);
         return result;
     }
     
-    if (header_count > 0) {
-        result = write_headers(*writer, headers, header_count);
-        if (result != CSV_WRITER_OK) {
-            if ((*writer)->owns_config) csv_config_free((*writer)->config);
-            fclose((*writer)->file);
-            return result;
-        }
-    }
-    
     return CSV_WRITER_OK;
 }
 
@@ -172,21 +549,10 @@ CSVWriterResult csv_writer_init_with_file(CSVWriter **writer, FILE *file, CSVCon
     (*writer)->config = config;
     (*writer)->owns_config = false;
     
-    (*writer)->delimiter = csv_config_get_delimiter((*writer)->config);
-    (*writer)->enclosure = csv_config_get_enclosure((*writer)->config);
-    (*writer)->escape = csv_config_get_escape((*writer)->config);
-    
-    if (csv_config_get_write_bom((*writer)->config)) {
-        result = write_bom((*writer)->file, csv_config_get_encoding((*writer)->config));
-        if (result != CSV_WRITER_OK) return result;
-    }
-    
-    result = copy_headers_to_arena(*writer, headers, header_count);
-    if (result != CSV_WRITER_OK) return result;
-    
-    if (header_count > 0) {
-        result = write_headers(*writer, headers, header_count);
-        if (result != CSV_WRITER_OK) return result;
+    result = start_output(*writer, headers, header_count);
+    if (result != CSV_WRITER_OK) {
+        discard_writer(*writer);
+        return result;
     }
     
     return CSV_WRITER_OK;
@@ -252,14 +618,15 @@ CSVWriterResult write_field(FILE *file, const FieldWriteOptions *options) {
     if (needs_quoting || options->needs_quoting) {
         if (fputc(options->enclosure, file) == EOF) return CSV_WRITER_ERROR_FILE_WRITE;
         
-        for (const char *p = field; *p; p++) {
-            if (*p == options->enclosure) {
-                if (fputc(options->enclosure, file) == EOF) return CSV_WRITER_ERROR_FILE_WRITE;
-                if (fputc(options->enclosure, file) == EOF) return CSV_WRITER_ERROR_FILE_WRITE;
-            } else {
-                if (fputc(*p, file) == EOF) return CSV_WRITER_ERROR_FILE_WRITE;
-            }
+        const char *p = field;
+        const char *q;
+        while (options->enclosure != '\0' && (q = strchr(p, options->enclosure)) != NULL) {
+            size_t run = (size_t)(q - p) + 1;
+            if (fwrite(p, 1, run, file) != run) return CSV_WRITER_ERROR_FILE_WRITE;
+            if (fputc(options->enclosure, file) == EOF) return CSV_WRITER_ERROR_FILE_WRITE;
+            p = q + 1;
         }
+        if (fputs(p, file) == EOF) return CSV_WRITER_ERROR_FILE_WRITE;
         
         if (fputc(options->enclosure, file) == EOF) return CSV_WRITER_ERROR_FILE_WRITE;
     } else {
@@ -273,117 +640,127 @@ CSVWriterResult write_headers(CSVWriter *writer, char **headers, int header_coun
     if (!writer || !headers || header_count <= 0) {
         return CSV_WRITER_ERROR_NULL_POINTER;
     }
+    if (!writer->buffer) return CSV_WRITER_ERROR_NULL_POINTER;
 
-    FieldWriteOptions options = {
-        .delimiter = writer->config->delimiter,
-        .enclosure = writer->config->enclosure,
-        .escape = writer->config->escape,
-        .strictMode = csv_config_get_strict_mode(writer->config)
-    };
-
-    for (int i = 0; i < header_count; i++) {
-        if (i > 0) {
-            if (fputc(writer->delimiter, writer->file) == EOF) {
-                return CSV_WRITER_ERROR_FILE_WRITE;
-            }
-        }
-        
-        options.field = headers[i];
-        options.needs_quoting = false;
-        
-        CSVWriterResult result = write_field(writer->file, &options);
-        if (result != CSV_WRITER_OK) return result;
-    }
-
-    if (fprintf(writer->file, "\n") < 0) return CSV_WRITER_ERROR_FILE_WRITE;
-    
-    if (csv_config_get_auto_flush(writer->config)) {
-        if (fflush(writer->file) != 0) return CSV_WRITER_ERROR_FILE_WRITE;
-    }
-    
-    return CSV_WRITER_OK;
+    return emit_record(writer, headers, header_count);
 }
 
 CSVWriterResult csv_writer_write_record(CSVWriter *writer, char **fields, int field_count) {
     if (!writer || !fields || field_count <= 0) {
         return CSV_WRITER_ERROR_NULL_POINTER;
     }
+    if (!writer->buffer) return CSV_WRITER_ERROR_NULL_POINTER;
+
+    CSVWriterResult result = async_error(writer);
+    if (result != CSV_WRITER_OK) return result;
+
+    return emit_record(writer, fields, field_count);
+}
 
-    FieldWriteOptions options = {
-        .delimiter = writer->config->delimiter,
-        .enclosure = writer->config->enclosure,
-        .escape = writer->config->escape,
-        .strictMode = csv_config_get_strict_mode(writer->config)
-    };
+CSVWriterResult csv_writer_write_record_map(CSVWriter *writer, char **field_names, char **field_values, int field_count) {
+    if (!writer || !writer->file) return CSV_WRITER_ERROR_NULL_POINTER;
+    if (!field_names || !field_values) return CSV_WRITER_ERROR_NULL_POINTER;
+    if (writer->header_count <= 0 || !writer->ordered_fields) return CSV_WRITER_ERROR_INVALID_FIELD_COUNT;
+
+    char **ordered_fields = writer->ordered_fields;
+    memset(ordered_fields, 0, writer->header_count * sizeof(char*));
 
     for (int i = 0; i < field_count; i++) {
-        if (i > 0) {
-            if (fputc(writer->delimiter, writer->file) == EOF) {
-                return CSV_WRITER_ERROR_FILE_WRITE;
-            }
+        int column = csv_header_map_find(&writer->header_map, field_names[i]);
+        if (column >= 0) {
+            ordered_fields[column] = field_values[i];
         }
-        
-        options.field = fields[i];
-        options.needs_quoting = false;
-        
-        CSVWriterResult result = write_field(writer->file, &options);
-        if (result != CSV_WRITER_OK) return result;
     }
     
-    if (fprintf(writer->file, "\n") < 0) return CSV_WRITER_ERROR_FILE_WRITE;
-    
-    if (csv_config_get_auto_flush(writer->config)) {
-        if (fflush(writer->file) != 0) return CSV_WRITER_ERROR_FILE_WRITE;
-    }
-    
-    return CSV_WRITER_OK;
+    return csv_writer_write_record(writer, ordered_fields, writer->header_count);
 }
 
-CSVWriterResult csv_writer_write_record_map(CSVWriter *writer, char **field_names, char **field_values, int field_count) {
-    if (!writer || !writer->file) return CSV_WRITER_ERROR_NULL_POINTER;
-    if (!field_names || !field_values) return CSV_WRITER_ERROR_NULL_POINTER;
+CSVWriterResult csv_writer_compile_plan(CSVWriter *writer, char **field_names, int field_count, CSVWriterFieldPlan **plan) {
+    if (!writer || !plan) return CSV_WRITER_ERROR_NULL_POINTER;
+    *plan = NULL;
+    if (field_count < 0 || (field_count > 0 && !field_names)) return CSV_WRITER_ERROR_NULL_POINTER;
     if (writer->header_count <= 0) return CSV_WRITER_ERROR_INVALID_FIELD_COUNT;
-    
-    if (writer->header_count > MAX_FIELDS) return CSV_WRITER_ERROR_BUFFER_OVERFLOW;
-    
-    char *ordered_fields[MAX_FIELDS];
-    
-    for (int i = 0; i < writer->header_count; i++) {
-        ordered_fields[i] = NULL;
+
+    void *ptr;
+    if (arena_alloc(writer->arena, sizeof(CSVWriterFieldPlan), &ptr) != ARENA_OK) {
+        return CSV_WRITER_ERROR_MEMORY_ALLOCATION;
     }
-    
-    for (int i = 0; i < field_count; i++) {
-        if (!field_names[i]) continue;
-        
-        for (int j = 0; j < writer->header_count; j++) {
-            if (writer->headers[j] && strcmp(field_names[i], writer->headers[j]) == 0) {
-                ordered_fields[j] = field_values[i];
-                break;
-            }
+    CSVWriterFieldPlan *compiled = (CSVWriterFieldPlan*)ptr;
+    compiled->columns = NULL;
+    compiled->field_count = field_count;
+
+    if (field_count > 0) {
+        if (arena_alloc(writer->arena, field_count * sizeof(int), &ptr) != ARENA_OK) {
+            return CSV_WRITER_ERROR_MEMORY_ALLOCATION;
+        }
+        compiled->columns = (int*)ptr;
+        for (int i = 0; i < field_count; i++) {
+            compiled->columns[i] = csv_header_map_find(&writer->header_map, field_names[i]);
         }
     }
-    
+
+    *plan = compiled;
+    return CSV_WRITER_OK;
+}
+
+CSVWriterResult csv_writer_write_record_plan(CSVWriter *writer, const CSVWriterFieldPlan *plan, char **field_values) {
+    if (!writer || !writer->file || !plan) return CSV_WRITER_ERROR_NULL_POINTER;
+    if (plan->field_count > 0 && !field_values) return CSV_WRITER_ERROR_NULL_POINTER;
+    if (writer->header_count <= 0 || !writer->ordered_fields) return CSV_WRITER_ERROR_INVALID_FIELD_COUNT;
+
+    char **ordered_fields = writer->ordered_fields;
+    memset(ordered_fields, 0, writer->header_count * sizeof(char*));
+
+    for (int i = 0; i < plan->field_count; i++) {
+        int column = plan->columns[i];
+        if (column >= 0 && column < writer->header_count) {
+            ordered_fields[column] = field_values[i];
+        }
+    }
+
     return csv_writer_write_record(writer, ordered_fields, writer->header_count);
 }
 
 CSVWriterResult csv_writer_flush(CSVWriter *writer) {
     if (!writer || !writer->file) return CSV_WRITER_ERROR_NULL_POINTER;
     
-    if (fflush(writer->file) != 0) return CSV_WRITER_ERROR_FILE_WRITE;
-    return CSV_WRITER_OK;
+    return commit_output(writer);
+}
+
+CSVWriterResult csv_writer_poll(CSVWriter *writer) {
+    if (!writer || !writer->file) return CSV_WRITER_ERROR_NULL_POINTER;
+
+    int interval_ms = csv_config_get_flush_interval_ms(writer->config);
+    if (!csv_config_get_auto_flush(writer->config) || interval_ms <= 0 || writer->buffer_used == 0 ||
+        monotonic_ms() - writer->last_flush_ms < (uint64_t)interval_ms) {
+        return async_error(writer);
+    }
+    if (writer->async && !csv_config_get_sync_on_flush(writer->config)) {
+        return flush_output(writer);
+    }
+    return commit_output(writer);
 }
 
-void csv_writer_free(CSVWriter *writer) {
-    if (!writer) return;
+CSVWriterResult csv_writer_free(CSVWriter *writer) {
+    if (!writer) return CSV_WRITER_ERROR_NULL_POINTER;
+    
+    CSVWriterResult result = CSV_WRITER_OK;
+    if (writer->file && writer->buffer) {
+        result = commit_output(writer);
+    }
+    CSVWriterResult async_result = stop_async(writer);
+    if (result == CSV_WRITER_OK) result = async_result;
+    free(writer->buffer);
+    writer->buffer = NULL;
     
     if (writer->file && writer->owns_file) {
-        fflush(writer->file);
-        fclose(writer->file);
+        if (fflush(writer->file) != 0 && result == CSV_WRITER_OK) result = CSV_WRITER_ERROR_FILE_WRITE;
+        if (fclose(writer->file) != 0 && result == CSV_WRITER_OK) result = CSV_WRITER_ERROR_FILE_WRITE;
     }
+    writer->file = NULL;
     
     if (writer->config && writer->owns_config) {
         csv_config_free(writer->config);
     }
-    
-
-} 
+    return result;
+}
@@ -3,8 +3,12 @@
 
 #include "csv_config.h"
 #include "arena.h"
+#include "csv_headers.h"
 #include <stdio.h>
 #include <stdbool.h>
+#include <stdint.h>
+
+#define CSV_WRITER_BUFFER_SIZE (64 * 1024)
 
 typedef enum {
     CSV_WRITER_OK = 0,
@@ -19,9 +23,13 @@ typedef enum {
     CSV_WRITER_ERROR_MAX
 } CSVWriterResult;
 
+typedef struct CSVWriterAsync CSVWriterAsync;
+
 typedef struct {
     char **headers;
     int header_count;
+    CSVHeaderMap header_map;
+    char **ordered_fields;
     FILE *file;
     CSVConfig *config;
     Arena *arena;
@@ -30,8 +38,23 @@ typedef struct {
     char escape;
     bool owns_file;
     bool owns_config;
+    char *buffer;
+    size_t buffer_size;
+    size_t buffer_used;
+    char quote_chars[6];
+    int pending_records;
+    uint64_t last_flush_ms;
+    CSVWriterAsync *async;
+    bool handoff_due;
+    unsigned long async_handoffs;
 } CSVWriter;
 
+/* Header column for each position of a fixed key set, or -1 for unknown keys. */
+typedef struct {
+    int *columns;
+    int field_count;
+} CSVWriterFieldPlan;
+
 typedef struct {
     const char *field;
     char delimiter;
@@ -45,8 +68,24 @@ CSVWriterResult csv_writer_init(CSVWriter **writer, CSVConfig *config, char **he
 CSVWriterResult csv_writer_init_with_file(CSVWriter **writer, FILE *file, CSVConfig *config, char **headers, int header_count, Arena *arena);
 CSVWriterResult csv_writer_write_record(CSVWriter *writer, char **fields, int field_count);
 CSVWriterResult csv_writer_write_record_map(CSVWriter *writer, char **field_names, char **field_values, int field_count);
+
+/*
+ * Resolves field_names against the headers once; write_record_plan then
+ * places values by position without any name lookups. The plan lives in
+ * the writer's arena.
+ */
+CSVWriterResult csv_writer_compile_plan(CSVWriter *writer, char **field_names, int field_count, CSVWriterFieldPlan **plan);
+CSVWriterResult csv_writer_write_record_plan(CSVWriter *writer, const CSVWriterFieldPlan *plan, char **field_values);
 CSVWriterResult csv_writer_flush(CSVWriter *writer);
-void csv_writer_free(CSVWriter *writer);
+
+/*
+ * flushIntervalMs is checked as records are written; a producer that goes
+ * idle calls this to flush rows buffered for longer than the interval.
+ */
+CSVWriterResult csv_writer_poll(CSVWriter *writer);
+
+/* Flushes, closes owned files and reports any write error not yet returned. */
+CSVWriterResult csv_writer_free(CSVWriter *writer);
 
 CSVWriterResult write_field(FILE *file, const FieldWriteOptions *options);
 CSVWriterResult write_headers(CSVWriter *writer, char **headers, int header_count);
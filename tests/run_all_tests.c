@@ -12,9 +12,19 @@ TestSuite test_suites[] = {
     {"Arena Tests", "./test_arena"},
     {"CSV Config Tests", "./test_csv_config"},
     {"CSV Utils Tests", "./test_csv_utils"},
+    {"CSV Headers Tests", "./test_csv_headers"},
+    {"CSV Buffer Tests", "./test_csv_buffer"},
+    {"CSV ReadAhead Tests", "./test_csv_readahead"},
+    {"CSV io_uring Tests", "./test_csv_uring"},
+    {"CSV Index Tests", "./test_csv_index"},
+    {"CSV Count Tests", "./test_csv_count"},
+    {"CSV SIMD Tests", "./test_csv_simd"},
     {"CSV Parser Tests", "./test_csv_parser"},
+    {"CSV Filter Tests", "./test_csv_filter"},
     {"CSV Writer Tests", "./test_csv_writer"},
-    {"CSV Reader Tests", "./test_csv_reader"}
+    {"CSV Reader Tests", "./test_csv_reader"},
+    {"CSV Parallel Tests", "./test_csv_parallel"},
+    {"CSV Push Parser Tests", "./test_csv_push"}
 };
 
 int run_test_suite(const TestSuite *suite) {
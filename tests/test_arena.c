@@ -213,6 +213,198 @@ void test_arena_get_sizes() {
     printf("✓ arena size functions passed\n");
 }
 
+void test_arena_growable() {
+    printf("Testing growable arena...\n");
+    
+    Arena arena;
+    assert(arena_create_growable(&arena, 128, 0) == ARENA_OK);
+    assert(arena_is_growable(&arena));
+    assert(arena.total_size == 128);
+    
+    void *first;
+    assert(arena_alloc(&arena, 100, &first) == ARENA_OK);
+    memset(first, 'a', 100);
+    
+    void *second;
+    assert(arena_alloc(&arena, 100, &second) == ARENA_OK);
+    memset(second, 'b', 100);
+    assert(arena.total_size == 128 + 256);
+    assert(((char*)first)[99] == 'a');
+    
+    void *large;
+    assert(arena_alloc(&arena, 4000, &large) == ARENA_OK);
+    assert(arena.block->size >= 4000);
+    assert(arena_get_used_size(&arena) == 104 + 104 + 4000);
+    assert(arena_can_allocate(&arena, 1 << 20));
+    
+    Arena fixed;
+    arena_create(&fixed, 128);
+    assert(!arena_is_growable(&fixed));
+    arena_destroy(&fixed);
+    
+    arena_destroy(&arena);
+    printf("✓ growable arena passed\n");
+}
+
+void test_arena_growable_cap() {
+    printf("Testing growable arena cap...\n");
+    
+    Arena arena;
+    assert(arena_create_growable(&arena, 256, 128) == ARENA_ERROR_INVALID_SIZE);
+    assert(arena_create_growable(&arena, 256, 1024) == ARENA_OK);
+    
+    void *ptr;
+    assert(arena_alloc(&arena, 256, &ptr) == ARENA_OK);
+    assert(arena_alloc(&arena, 512, &ptr) == ARENA_OK);
+    assert(arena.total_size == 768);
+    
+    assert(arena_can_allocate(&arena, 256) == true);
+    assert(arena_can_allocate(&arena, 512) == false);
+    assert(arena_alloc(&arena, 512, &ptr) == ARENA_ERROR_OUT_OF_MEMORY);
+    assert(ptr == NULL);
+    
+    assert(arena_alloc(&arena, 256, &ptr) == ARENA_OK);
+    assert(arena.total_size == 1024);
+    assert(arena_alloc(&arena, 8, &ptr) == ARENA_ERROR_OUT_OF_MEMORY);
+    
+    arena_destroy(&arena);
+    printf("✓ growable arena cap passed\n");
+}
+
+void test_arena_growable_reset() {
+    printf("Testing growable arena reset...\n");
+    
+    Arena arena;
+    arena_create_growable(&arena, 64, 0);
+    
+    void *ptr;
+    arena_alloc(&arena, 64, &ptr);
+    arena_alloc(&arena, 1000, &ptr);
+    arena_alloc(&arena, 16, &ptr);
+    assert(arena.block->prev != NULL);
+    size_t largest = 1000;
+    for (ArenaBlock *block = arena.block; block; block = block->prev) {
+        if (block->size > largest) largest = block->size;
+    }
+    
+    arena_reset(&arena);
+    assert(arena.block->prev == NULL);
+    assert(arena.block->size == largest);
+    assert(arena.total_size == largest);
+    assert(arena_get_used_size(&arena) == 0);
+    assert(arena_get_free_size(&arena) == largest);
+    
+    char *before = arena.memory;
+    assert(arena_alloc(&arena, 1000, &ptr) == ARENA_OK);
+    assert(ptr == before);
+    assert(arena.total_size == largest);
+    
+    arena_destroy(&arena);
+    printf("✓ growable arena reset passed\n");
+}
+
+void test_arena_growable_regions() {
+    printf("Testing growable arena regions...\n");
+    
+    Arena arena;
+    arena_create_growable(&arena, 128, 0);
+    
+    void *ptr;
+    arena_alloc(&arena, 64, &ptr);
+    ArenaRegion region = arena_begin_region(&arena);
+    char *checkpoint = arena.current;
+    
+    for (int i = 0; i < 10; i++) {
+        assert(arena_alloc(&arena, 500, &ptr) == ARENA_OK);
+    }
+    assert(arena.block != region.block);
+    
+    assert(arena_restore_region(&region) == ARENA_OK);
+    assert(arena.block == region.block);
+    assert(arena.block->prev == NULL);
+    assert(arena.current == checkpoint);
+    assert(arena.total_size == 128);
+    assert(arena_get_used_size(&arena) == 64);
+    
+    arena_alloc(&arena, 1000, &ptr);
+    ArenaRegion inner = arena_begin_region(&arena);
+    arena_alloc(&arena, 5000, &ptr);
+    arena_end_region(&inner);
+    assert(arena.block == inner.block);
+    assert(arena_get_used_size(&arena) == 64 + 1000);
+    
+    arena_reset(&arena);
+    assert(arena_restore_region(&region) == ARENA_ERROR_INVALID_SIZE);
+    
+    arena_destroy(&arena);
+    printf("✓ growable arena regions passed\n");
+}
+
+void test_arena_realloc_in_place() {
+    printf("Testing arena_realloc in place...\n");
+    
+    Arena arena;
+    arena_create(&arena, TEST_ARENA_SIZE);
+    
+    void *first;
+    arena_alloc(&arena, 10, &first);
+    char *grown = arena_realloc(&arena, first, 10, 100);
+    assert(grown == first);
+    assert(arena_get_used_size(&arena) == 104);
+    
+    void *second;
+    arena_alloc(&arena, 8, &second);
+    memset(grown, 'z', 100);
+    char *moved = arena_realloc(&arena, grown, 100, 200);
+    assert(moved != grown);
+    assert(moved[0] == 'z' && moved[99] == 'z');
+    assert(arena_get_used_size(&arena) == 104 + 8 + 200);
+    
+    assert(arena_realloc(&arena, moved, 200, 900) == moved);
+    assert(arena_realloc(&arena, moved, 900, 1000) == NULL);
+    
+    arena_destroy(&arena);
+    printf("✓ arena_realloc in place passed\n");
+}
+
+void test_arena_reserve_commit() {
+    printf("Testing arena reserve/commit...\n");
+    
+    Arena arena;
+    arena_create(&arena, TEST_ARENA_SIZE);
+    
+    size_t available;
+    char *buffer = arena_reserve(&arena, 16, &available);
+    assert(buffer == arena.memory);
+    assert(available == TEST_ARENA_SIZE);
+    assert(arena_get_used_size(&arena) == 0);
+    
+    assert(arena_grow_reservation(&arena, buffer, 0, 512, &available) == buffer);
+    assert(arena_grow_reservation(&arena, buffer, 0, 2048, &available) == NULL);
+    assert(arena_commit(&arena, buffer, 13) == ARENA_OK);
+    assert(arena_get_used_size(&arena) == 16);
+    assert(arena_commit(&arena, buffer, 8) == ARENA_ERROR_INVALID_SIZE);
+    assert(arena_reserve(&arena, 2048, &available) == NULL);
+    arena_destroy(&arena);
+    
+    arena_create_growable(&arena, 64, 0);
+    buffer = arena_reserve(&arena, 16, &available);
+    assert(available == 64);
+    memset(buffer, 'q', 64);
+    
+    char *moved = arena_grow_reservation(&arena, buffer, 64, 128, &available);
+    assert(moved != NULL && moved != buffer);
+    assert(available >= 128);
+    assert(moved[0] == 'q' && moved[63] == 'q');
+    assert(arena_get_used_size(&arena) == 0);
+    
+    assert(arena_commit(&arena, moved, 100) == ARENA_OK);
+    assert(arena_get_used_size(&arena) == 104);
+    
+    arena_destroy(&arena);
+    printf("✓ arena reserve/commit passed\n");
+}
+
 int main() {
     printf("Running Arena Tests...\n\n");
     
@@ -228,6 +420,12 @@ int main() {
     test_arena_regions();
     test_arena_can_allocate();
     test_arena_get_sizes();
+    test_arena_growable();
+    test_arena_growable_cap();
+    test_arena_growable_reset();
+    test_arena_growable_regions();
+    test_arena_realloc_in_place();
+    test_arena_reserve_commit();
     
     printf("\n✅ All Arena tests passed!\n");
     return 0;
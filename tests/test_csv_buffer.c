@@ -0,0 +1,277 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../csv_buffer.h"
+
+static void write_test_file(const char *filename, const char *content, size_t length) {
+    FILE *file = fopen(filename, "wb");
+    assert(file != NULL);
+    fwrite(content, 1, length, file);
+    fclose(file);
+}
+
+void test_csv_buffer_open_close() {
+    printf("Testing csv_buffer_open/close...\n");
+    write_test_file("test_buffer_open.csv", "a,b\n", 4);
+
+    CSVBuffer buffer;
+    assert(csv_buffer_open(&buffer, "test_buffer_open.csv", 0) == CSV_BUFFER_OK);
+    assert(csv_buffer_is_open(&buffer));
+    assert(buffer.capacity == CSV_BUFFER_DEFAULT_SIZE);
+    csv_buffer_close(&buffer);
+    assert(!csv_buffer_is_open(&buffer));
+
+    assert(csv_buffer_open(&buffer, "does_not_exist.csv", 0) == CSV_BUFFER_ERROR_FILE_OPEN);
+    assert(csv_buffer_open(NULL, "test_buffer_open.csv", 0) == CSV_BUFFER_ERROR_NULL_POINTER);
+    assert(csv_buffer_next_record(NULL, '"', NULL) == NULL);
+
+    remove("test_buffer_open.csv");
+    printf("✓ csv_buffer_open/close test passed\n");
+}
+
+void test_csv_buffer_line_endings() {
+    printf("Testing csv_buffer line endings...\n");
+    const char *content = "a,b\r\nc,d\re,f\n\ng,h";
+    write_test_file("test_buffer_eol.csv", content, strlen(content));
+
+    CSVBuffer buffer;
+    assert(csv_buffer_open(&buffer, "test_buffer_eol.csv", 4) == CSV_BUFFER_OK);
+
+    size_t length;
+    const char *record = csv_buffer_next_record(&buffer, '"', &length);
+    assert(record && strcmp(record, "a,b") == 0 && length == 3);
+    record = csv_buffer_next_record(&buffer, '"', &length);
+    assert(record && strcmp(record, "c,d") == 0);
+    record = csv_buffer_next_record(&buffer, '"', &length);
+    assert(record && strcmp(record, "e,f") == 0);
+    record = csv_buffer_next_record(&buffer, '"', &length);
+    assert(record && strcmp(record, "") == 0 && length == 0);
+    record = csv_buffer_next_record(&buffer, '"', &length);
+    assert(record && strcmp(record, "g,h") == 0);
+    assert(csv_buffer_next_record(&buffer, '"', &length) == NULL);
+    assert(!csv_buffer_has_data(&buffer));
+
+    csv_buffer_close(&buffer);
+    remove("test_buffer_eol.csv");
+    printf("✓ csv_buffer line endings test passed\n");
+}
+
+void test_csv_buffer_quoted_records_across_refills() {
+    printf("Testing csv_buffer quoted records across refills...\n");
+    const char *content = "1,\"multi\nline \"\"quoted\"\"\r\nfield\",x\n2,\"\"\"\",y\n";
+    write_test_file("test_buffer_quotes.csv", content, strlen(content));
+
+    CSVBuffer buffer;
+    assert(csv_buffer_open(&buffer, "test_buffer_quotes.csv", 3) == CSV_BUFFER_OK);
+
+    const char *record = csv_buffer_next_record(&buffer, '"', NULL);
+    assert(record && strcmp(record, "1,\"multi\nline \"\"quoted\"\"\r\nfield\",x") == 0);
+    record = csv_buffer_next_record(&buffer, '"', NULL);
+    assert(record && strcmp(record, "2,\"\"\"\",y") == 0);
+    assert(csv_buffer_next_record(&buffer, '"', NULL) == NULL);
+
+    csv_buffer_close(&buffer);
+    remove("test_buffer_quotes.csv");
+    printf("✓ csv_buffer quoted records across refills test passed\n");
+}
+
+void test_csv_buffer_seek_and_tell() {
+    printf("Testing csv_buffer seek and tell...\n");
+    const char *content = "h1,h2\nr1,a\nr2,b\n";
+    write_test_file("test_buffer_seek.csv", content, strlen(content));
+
+    CSVBuffer buffer;
+    assert(csv_buffer_open(&buffer, "test_buffer_seek.csv", 0) == CSV_BUFFER_OK);
+    assert(csv_buffer_tell(&buffer) == 0);
+
+    assert(csv_buffer_next_record(&buffer, '"', NULL) != NULL);
+    off_t second = csv_buffer_tell(&buffer);
+    assert(second == 6);
+
+    const char *record = csv_buffer_next_record(&buffer, '"', NULL);
+    assert(record && strcmp(record, "r1,a") == 0);
+
+    assert(csv_buffer_seek(&buffer, second) == CSV_BUFFER_OK);
+    record = csv_buffer_next_record(&buffer, '"', NULL);
+    assert(record && strcmp(record, "r1,a") == 0);
+
+    assert(csv_buffer_seek(&buffer, 0) == CSV_BUFFER_OK);
+    record = csv_buffer_next_record(&buffer, '"', NULL);
+    assert(record && strcmp(record, "h1,h2") == 0);
+
+    csv_buffer_close(&buffer);
+    remove("test_buffer_seek.csv");
+    printf("✓ csv_buffer seek and tell test passed\n");
+}
+
+void test_csv_buffer_record_larger_than_buffer() {
+    printf("Testing csv_buffer record larger than buffer...\n");
+    size_t field_length = 3 * CSV_BUFFER_DEFAULT_SIZE;
+    size_t length = field_length + 16;
+    char *content = malloc(length);
+    assert(content != NULL);
+
+    size_t pos = 0;
+    content[pos++] = '"';
+    memset(content + pos, 'x', field_length);
+    content[pos + field_length / 2] = '\n';
+    pos += field_length;
+    memcpy(content + pos, "\",1\nnext\n", 9);
+    pos += 9;
+    write_test_file("test_buffer_large.csv", content, pos);
+
+    CSVBuffer buffer;
+    assert(csv_buffer_open(&buffer, "test_buffer_large.csv", 0) == CSV_BUFFER_OK);
+
+    size_t record_length;
+    const char *record = csv_buffer_next_record(&buffer, '"', &record_length);
+    assert(record != NULL);
+    assert(record_length == field_length + 4);
+    assert(memcmp(record, content, record_length) == 0);
+
+    record = csv_buffer_next_record(&buffer, '"', NULL);
+    assert(record && strcmp(record, "next") == 0);
+
+    csv_buffer_close(&buffer);
+    free(content);
+    remove("test_buffer_large.csv");
+    printf("✓ csv_buffer record larger than buffer test passed\n");
+}
+
+void test_csv_buffer_open_mapped() {
+    printf("Testing csv_buffer_open_mapped...\n");
+    const char *content = "a,b\r\n\"x\ny\",z\nlast";
+    write_test_file("test_buffer_mapped.csv", content, strlen(content));
+
+    CSVBuffer buffer;
+    assert(csv_buffer_open_mapped(&buffer, "test_buffer_mapped.csv") == CSV_BUFFER_OK);
+    assert(buffer.source == CSV_BUFFER_SOURCE_MMAP);
+    assert(buffer.eof == true);
+
+    size_t length;
+    const char *record = csv_buffer_next_record(&buffer, '"', &length);
+    assert(record == buffer.data);
+    assert(length == 3 && strncmp(record, "a,b", length) == 0);
+    record = csv_buffer_next_record(&buffer, '"', &length);
+    assert(length == 7 && strncmp(record, "\"x\ny\",z", length) == 0);
+    record = csv_buffer_next_record(&buffer, '"', &length);
+    assert(length == 4 && strncmp(record, "last", length) == 0);
+    assert(csv_buffer_next_record(&buffer, '"', &length) == NULL);
+
+    assert(csv_buffer_seek(&buffer, 5) == CSV_BUFFER_OK);
+    record = csv_buffer_next_record(&buffer, '"', &length);
+    assert(length == 7 && record[0] == '"');
+    assert(csv_buffer_seek(&buffer, 1000) == CSV_BUFFER_ERROR_FILE_SEEK);
+
+    csv_buffer_close(&buffer);
+    assert(!csv_buffer_is_open(&buffer));
+
+    write_test_file("test_buffer_mapped_empty.csv", "", 0);
+    assert(csv_buffer_open_mapped(&buffer, "test_buffer_mapped_empty.csv") == CSV_BUFFER_ERROR_UNSUPPORTED);
+    assert(csv_buffer_open_mapped(&buffer, "/dev/null") == CSV_BUFFER_ERROR_UNSUPPORTED);
+    assert(csv_buffer_open_mapped(&buffer, "does_not_exist.csv") == CSV_BUFFER_ERROR_FILE_OPEN);
+
+    remove("test_buffer_mapped.csv");
+    remove("test_buffer_mapped_empty.csv");
+    printf("✓ csv_buffer_open_mapped test passed\n");
+}
+
+void test_csv_buffer_open_memory() {
+    printf("Testing csv_buffer_open_memory...\n");
+    const char content[] = "a,\"b\nc\"\r\nd,e";
+    size_t content_length = sizeof(content) - 1;
+
+    CSVBuffer buffer;
+    assert(csv_buffer_open_memory(&buffer, content, content_length) == CSV_BUFFER_OK);
+    assert(csv_buffer_is_open(&buffer));
+    assert(buffer.source == CSV_BUFFER_SOURCE_MEMORY);
+
+    size_t length;
+    const char *record = csv_buffer_next_record(&buffer, '"', &length);
+    assert(record == content && length == 7);
+    record = csv_buffer_next_record(&buffer, '"', &length);
+    assert(record == content + 9 && length == 3);
+    assert(csv_buffer_next_record(&buffer, '"', &length) == NULL);
+
+    assert(csv_buffer_seek(&buffer, 0) == CSV_BUFFER_OK);
+    assert(csv_buffer_has_data(&buffer));
+    assert(memcmp(content, "a,\"b\nc\"\r\nd,e", content_length) == 0);
+
+    csv_buffer_close(&buffer);
+    assert(!csv_buffer_is_open(&buffer));
+    assert(csv_buffer_open_memory(&buffer, NULL, 0) == CSV_BUFFER_ERROR_NULL_POINTER);
+
+    printf("✓ csv_buffer_open_memory test passed\n");
+}
+
+void test_csv_buffer_unquoted_framing() {
+    printf("Testing csv_buffer unquoted framing...\n");
+    const char *content = "a,b\r\nc,d\re,f\ng,\"h\ni\"\nj,k\n";
+    write_test_file("test_buffer_unquoted.csv", content, strlen(content));
+
+    CSVBuffer buffer;
+    assert(csv_buffer_open(&buffer, "test_buffer_unquoted.csv", 4) == CSV_BUFFER_OK);
+    bool unquoted = true;
+    const char *expected[] = {"a,b", "c,d", "e,f"};
+    for (int i = 0; i < 3; i++) {
+        const char *record = csv_buffer_next_record_unquoted(&buffer, '"', &unquoted, NULL);
+        assert(record && strcmp(record, expected[i]) == 0 && unquoted);
+    }
+    const char *record = csv_buffer_next_record_unquoted(&buffer, '"', &unquoted, NULL);
+    assert(record && strcmp(record, "g,\"h\ni\"") == 0 && !unquoted);
+    csv_buffer_close(&buffer);
+
+    /* Random framing matches the quote-tracking scan record for record. */
+    const char alphabet[] = "ab,,\"\n\n\r";
+    char data[512];
+    srand(2024);
+    for (int iteration = 0; iteration < 2000; iteration++) {
+        size_t length = (size_t)(rand() % (int)sizeof(data));
+        bool quoted = rand() % 2;
+        for (size_t i = 0; i < length; i++) {
+            data[i] = alphabet[rand() % (sizeof(alphabet) - 1)];
+            if (!quoted && data[i] == '"') data[i] = 'c';
+        }
+        write_test_file("test_buffer_unquoted.csv", data, length);
+
+        CSVBuffer tracked;
+        CSVBuffer framed;
+        size_t capacity = 1 + (size_t)(rand() % 64);
+        assert(csv_buffer_open(&tracked, "test_buffer_unquoted.csv", capacity) == CSV_BUFFER_OK);
+        assert(csv_buffer_open(&framed, "test_buffer_unquoted.csv", capacity) == CSV_BUFFER_OK);
+        unquoted = true;
+        for (;;) {
+            size_t tracked_length;
+            size_t framed_length;
+            const char *expected_record = csv_buffer_next_record(&tracked, '"', &tracked_length);
+            const char *framed_record = csv_buffer_next_record_unquoted(&framed, '"', &unquoted, &framed_length);
+            assert((expected_record == NULL) == (framed_record == NULL));
+            if (!expected_record) {
+                break;
+            }
+            assert(tracked_length == framed_length && memcmp(expected_record, framed_record, framed_length) == 0);
+            assert(csv_buffer_tell(&tracked) == csv_buffer_tell(&framed));
+        }
+        assert(unquoted == !memchr(data, '"', length));
+        csv_buffer_close(&tracked);
+        csv_buffer_close(&framed);
+    }
+
+    remove("test_buffer_unquoted.csv");
+    printf("✓ csv_buffer unquoted framing test passed\n");
+}
+
+int main() {
+    printf("Running CSV Buffer tests...\n\n");
+    test_csv_buffer_open_close();
+    test_csv_buffer_line_endings();
+    test_csv_buffer_quoted_records_across_refills();
+    test_csv_buffer_seek_and_tell();
+    test_csv_buffer_record_larger_than_buffer();
+    test_csv_buffer_open_mapped();
+    test_csv_buffer_open_memory();
+    test_csv_buffer_unquoted_framing();
+    printf("\n✅ All CSV Buffer tests passed!\n");
+    return 0;
+}
@@ -27,6 +27,34 @@ void test_csv_config_set_get() {
     assert(csv_config_get_enclosure(config) == '\'');
     assert(csv_config_get_escape(config) == '\\');
     assert(strcmp(csv_config_get_path(config), "test.csv") == 0);
+    csv_config_set_reader_backend(config, CSV_READER_BACKEND_MMAP);
+    assert(csv_config_get_reader_backend(config) == CSV_READER_BACKEND_MMAP);
+    csv_config_set_index_stride(config, 256);
+    assert(csv_config_get_index_stride(config) == 256);
+    csv_config_set_index_stride(config, -5);
+    assert(csv_config_get_index_stride(config) == 0);
+    csv_config_set_persist_index(config, true);
+    assert(csv_config_get_persist_index(config) == true);
+    csv_config_set_flush_records(config, 100);
+    assert(csv_config_get_flush_records(config) == 100);
+    csv_config_set_flush_records(config, -1);
+    assert(csv_config_get_flush_records(config) == 0);
+    csv_config_set_flush_bytes(config, 8192);
+    assert(csv_config_get_flush_bytes(config) == 8192);
+    csv_config_set_flush_interval_ms(config, 250);
+    assert(csv_config_get_flush_interval_ms(config) == 250);
+    csv_config_set_sync_on_flush(config, true);
+    assert(csv_config_get_sync_on_flush(config) == true);
+    csv_config_set_async_write(config, true);
+    assert(csv_config_get_async_write(config) == true);
+    csv_config_set_read_ahead_buffers(config, 8);
+    assert(csv_config_get_read_ahead_buffers(config) == 8);
+    csv_config_set_read_ahead_buffers(config, -2);
+    assert(csv_config_get_read_ahead_buffers(config) == 0);
+    csv_config_set_read_ahead_buffer_size(config, 4 * 1024 * 1024);
+    assert(csv_config_get_read_ahead_buffer_size(config) == 4 * 1024 * 1024);
+    csv_config_set_quoting(config, CSV_QUOTING_NONE);
+    assert(csv_config_get_quoting(config) == CSV_QUOTING_NONE);
     arena_destroy(&arena);
     printf("✓ csv_config_set/get passed\n");
 }
@@ -67,6 +95,17 @@ void test_csv_config_defaults() {
     assert(csv_config_get_skip_empty_lines(config) == false);
     assert(csv_config_get_trim_fields(config) == false);
     assert(csv_config_get_preserve_quotes(config) == false);
+    assert(csv_config_get_reader_backend(config) == CSV_READER_BACKEND_STREAM);
+    assert(csv_config_get_index_stride(config) == 0);
+    assert(csv_config_get_persist_index(config) == false);
+    assert(csv_config_get_flush_records(config) == 0);
+    assert(csv_config_get_flush_bytes(config) == 0);
+    assert(csv_config_get_flush_interval_ms(config) == 0);
+    assert(csv_config_get_sync_on_flush(config) == false);
+    assert(csv_config_get_async_write(config) == false);
+    assert(csv_config_get_read_ahead_buffers(config) == 0);
+    assert(csv_config_get_read_ahead_buffer_size(config) == 0);
+    assert(csv_config_get_quoting(config) == CSV_QUOTING_DETECT);
     arena_destroy(&arena);
     printf("✓ csv_config defaults passed\n");
 }
@@ -150,6 +189,17 @@ void test_csv_config_null_safety() {
     assert(csv_config_get_skip_empty_lines(NULL) == false);
     assert(csv_config_get_trim_fields(NULL) == false);
     assert(csv_config_get_preserve_quotes(NULL) == false);
+    assert(csv_config_get_reader_backend(NULL) == CSV_READER_BACKEND_STREAM);
+    assert(csv_config_get_index_stride(NULL) == 0);
+    assert(csv_config_get_persist_index(NULL) == false);
+    assert(csv_config_get_flush_records(NULL) == 0);
+    assert(csv_config_get_flush_bytes(NULL) == 0);
+    assert(csv_config_get_flush_interval_ms(NULL) == 0);
+    assert(csv_config_get_sync_on_flush(NULL) == false);
+    assert(csv_config_get_async_write(NULL) == false);
+    assert(csv_config_get_read_ahead_buffers(NULL) == 0);
+    assert(csv_config_get_read_ahead_buffer_size(NULL) == 0);
+    assert(csv_config_get_quoting(NULL) == CSV_QUOTING_DETECT);
     
     csv_config_set_delimiter(NULL, ';');
     csv_config_set_enclosure(NULL, '\'');
@@ -164,6 +214,17 @@ void test_csv_config_null_safety() {
     csv_config_set_skip_empty_lines(NULL, true);
     csv_config_set_trim_fields(NULL, true);
     csv_config_set_preserve_quotes(NULL, true);
+    csv_config_set_reader_backend(NULL, CSV_READER_BACKEND_MMAP);
+    csv_config_set_index_stride(NULL, 64);
+    csv_config_set_persist_index(NULL, true);
+    csv_config_set_flush_records(NULL, 10);
+    csv_config_set_flush_bytes(NULL, 10);
+    csv_config_set_flush_interval_ms(NULL, 10);
+    csv_config_set_sync_on_flush(NULL, true);
+    csv_config_set_async_write(NULL, true);
+    csv_config_set_read_ahead_buffers(NULL, 4);
+    csv_config_set_read_ahead_buffer_size(NULL, 4096);
+    csv_config_set_quoting(NULL, CSV_QUOTING_FULL);
     
     printf("✓ csv_config null safety passed\n");
 }
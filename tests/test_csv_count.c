@@ -0,0 +1,141 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "../csv_count.h"
+#include "../csv_buffer.h"
+#include "../csv_simd.h"
+
+static long reference_count(const char *data, size_t length, char enclosure, bool skip_empty_lines, long skip_records) {
+    CSVBuffer buffer;
+    assert(csv_buffer_open_memory(&buffer, data, length) == CSV_BUFFER_OK);
+
+    long count = 0;
+    size_t record_length;
+    const char *record;
+    while ((record = csv_buffer_next_record(&buffer, enclosure, &record_length)) != NULL) {
+        if (skip_records > 0) {
+            skip_records--;
+            continue;
+        }
+        if (skip_empty_lines) {
+            bool blank = true;
+            for (size_t i = 0; i < record_length; i++) {
+                if (record[i] != ' ' && record[i] != '\t' && record[i] != '\r' && record[i] != '\n') {
+                    blank = false;
+                    break;
+                }
+            }
+            if (blank) continue;
+        }
+        count++;
+    }
+
+    csv_buffer_close(&buffer);
+    return count;
+}
+
+static long count_in_pieces(const char *data, size_t length, char enclosure, bool skip_empty_lines,
+                            long skip_records, size_t max_piece) {
+    CSVRecordCounter counter;
+    csv_count_init(&counter, enclosure, skip_empty_lines, skip_records);
+
+    size_t pos = 0;
+    while (pos < length) {
+        size_t piece = 1 + (size_t)rand() % max_piece;
+        if (piece > length - pos) piece = length - pos;
+        csv_count_feed(&counter, data + pos, piece);
+        pos += piece;
+    }
+    return csv_count_finish(&counter);
+}
+
+static long count_string(const char *data, char enclosure, bool skip_empty_lines, long skip_records) {
+    return csv_count_records(data, strlen(data), enclosure, skip_empty_lines, skip_records);
+}
+
+void test_csv_count_basic() {
+    printf("Testing csv_count_records basics...\n");
+
+    assert(count_string("", '"', false, 0) == 0);
+    assert(count_string("a", '"', false, 0) == 1);
+    assert(count_string("a\n", '"', false, 0) == 1);
+    assert(count_string("a\r\nb\r\n", '"', false, 0) == 2);
+    assert(count_string("a\rb\r", '"', false, 0) == 2);
+    assert(count_string("a\n\nb", '"', false, 0) == 3);
+    assert(count_string("a\n\nb", '"', true, 0) == 2);
+    assert(count_string("a\n \t\r\nb\n", '"', true, 0) == 2);
+    assert(count_string("h\n\"x\ny\",1\n\"\"\"\n\"\n", '"', false, 1) == 2);
+    assert(count_string("'a\nb',c\n", '\'', false, 0) == 1);
+    assert(count_string("\"unterminated\nquote", '"', false, 0) == 1);
+    assert(count_string("header", '"', false, 1) == 0);
+
+    printf("✓ csv_count_records basics test passed\n");
+}
+
+void test_csv_count_matches_scanner() {
+    printf("Testing csv_count against the record scanner...\n");
+    const char alphabet[] = "ab,\"\"\n\n\r \t";
+    char data[512];
+    CSVSimdLevel detected = csv_simd_detect_level();
+
+    srand(1234);
+    for (int iteration = 0; iteration < 3000; iteration++) {
+        size_t length = (size_t)rand() % sizeof(data);
+        for (size_t i = 0; i < length; i++) {
+            data[i] = alphabet[rand() % (sizeof(alphabet) - 1)];
+        }
+        bool skip_empty_lines = (iteration & 1) != 0;
+        long skip_records = (iteration & 2) ? 1 : 0;
+        long expected = reference_count(data, length, '"', skip_empty_lines, skip_records);
+
+        csv_simd_set_level((CSVSimdLevel)(iteration % ((int)detected + 1)));
+        assert(csv_count_records(data, length, '"', skip_empty_lines, skip_records) == expected);
+        assert(count_in_pieces(data, length, '"', skip_empty_lines, skip_records, 1) == expected);
+        assert(count_in_pieces(data, length, '"', skip_empty_lines, skip_records, 70) == expected);
+    }
+
+    csv_simd_set_level(detected);
+    printf("✓ csv_count scanner comparison test passed\n");
+}
+
+void test_csv_count_fd() {
+    printf("Testing csv_count_fd...\n");
+    FILE *file = fopen("test_count.csv", "wb");
+    assert(file != NULL);
+    fputs("id,text\r\n", file);
+    for (int i = 0; i < 20000; i++) {
+        if (i % 10 == 0) {
+            fputs("\n", file);
+        } else if (i % 10 == 1) {
+            fprintf(file, "%d,\"multi\r\nline\"\r\n", i);
+        } else {
+            fprintf(file, "%d,plain\n", i);
+        }
+    }
+    fclose(file);
+
+    int fd = open("test_count.csv", O_RDONLY);
+    assert(fd >= 0);
+    assert(csv_count_fd(fd, '"', false, 1) == 20000);
+    assert(csv_count_fd(fd, '"', true, 1) == 18000);
+    assert(csv_count_fd(fd, '"', false, 0) == 20001);
+    close(fd);
+
+    assert(csv_count_fd(-1, '"', false, 0) == -1);
+    assert(csv_count_finish(NULL) == -1);
+
+    remove("test_count.csv");
+    printf("✓ csv_count_fd test passed\n");
+}
+
+int main() {
+    printf("Running CSV Count tests...\n\n");
+    test_csv_count_basic();
+    test_csv_count_matches_scanner();
+    test_csv_count_fd();
+    printf("\n✅ All CSV Count tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,160 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../csv_filter.h"
+#include "../csv_reader.h"
+#include "../arena.h"
+
+static bool matches(const CSVPredicate *predicate, const char *line, Arena *arena, const CSVConfig *config) {
+    CSVParseViewResult views = csv_parse_line_views(line, strlen(line), arena, config, 1);
+    assert(views.success);
+    bool split = csv_predicate_matches(predicate, views.fields.fields, views.fields.count, config, arena);
+    bool lazy = csv_predicate_matches_line(predicate, line, strlen(line), config, arena);
+    assert(split == lazy);
+    return split;
+}
+
+void test_csv_predicate_leaves() {
+    printf("Testing csv_predicate leaves and combinators...\n");
+    Arena arena;
+    assert(arena_create(&arena, 64 * 1024) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+
+    const char *line = "FR,\"Paris \"\"Centre\"\"\",  42.5 ,x";
+    assert(matches(csv_predicate_equals(&arena, 0, "FR"), line, &arena, config));
+    assert(!matches(csv_predicate_equals(&arena, 0, "F"), line, &arena, config));
+    assert(matches(csv_predicate_equals(&arena, 1, "Paris \"Centre\""), line, &arena, config));
+    assert(matches(csv_predicate_prefix(&arena, 1, "Paris"), line, &arena, config));
+    assert(!matches(csv_predicate_prefix(&arena, 1, "Centre"), line, &arena, config));
+    assert(matches(csv_predicate_contains(&arena, 1, "\"Centre\""), line, &arena, config));
+    assert(matches(csv_predicate_contains(&arena, 1, ""), line, &arena, config));
+    assert(!matches(csv_predicate_contains(&arena, 1, "Lyon"), line, &arena, config));
+    assert(matches(csv_predicate_range(&arena, 2, 42, 43), line, &arena, config));
+    assert(!matches(csv_predicate_range(&arena, 2, 0, 42), line, &arena, config));
+    assert(!matches(csv_predicate_range(&arena, 3, -1e9, 1e9), line, &arena, config));
+
+    assert(matches(csv_predicate_equals(&arena, 7, ""), line, &arena, config));
+    assert(!matches(csv_predicate_range(&arena, 7, -1, 1), line, &arena, config));
+
+    CSVPredicate *country = csv_predicate_equals(&arena, 0, "DE");
+    CSVPredicate *price = csv_predicate_range(&arena, 2, 40, 50);
+    assert(!matches(csv_predicate_and(&arena, country, price), line, &arena, config));
+    assert(matches(csv_predicate_or(&arena, country, price), line, &arena, config));
+    CSVPredicate *nested = csv_predicate_and(&arena, csv_predicate_or(&arena, country, csv_predicate_prefix(&arena, 0, "F")), price);
+    assert(matches(nested, line, &arena, config));
+    assert(csv_predicate_max_column(nested) == 2);
+
+    assert(csv_predicate_equals(&arena, -1, "x") == NULL);
+    assert(csv_predicate_equals(&arena, 0, NULL) == NULL);
+    assert(csv_predicate_and(&arena, country, NULL) == NULL);
+    assert(csv_predicate_or(&arena, csv_predicate_equals(&arena, -1, "x"), price) == NULL);
+    assert(csv_predicate_max_column(NULL) == -1);
+    assert(matches(NULL, line, &arena, config));
+
+    arena_destroy(&arena);
+    printf("✓ csv_predicate leaves and combinators test passed\n");
+}
+
+void test_csv_predicate_short_circuit() {
+    printf("Testing csv_predicate_matches_line short-circuit...\n");
+    Arena arena;
+    assert(arena_create(&arena, 64 * 1024) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+
+    /* Column 2 is malformed; only predicates that reach it see the damage. */
+    const char *line = "a,b,\"x\"y,d";
+    size_t length = strlen(line);
+    CSVPredicate *late = csv_predicate_equals(&arena, 3, "d");
+
+    CSVPredicate *fails_early = csv_predicate_and(&arena, csv_predicate_equals(&arena, 0, "z"), late);
+    assert(!csv_predicate_matches_line(fails_early, line, length, config, &arena));
+
+    CSVPredicate *passes_early = csv_predicate_or(&arena, csv_predicate_equals(&arena, 1, "b"), late);
+    assert(csv_predicate_matches_line(passes_early, line, length, config, &arena));
+
+    /* A record that cannot be split is let through for the caller to report. */
+    CSVPredicate *reaches_damage = csv_predicate_and(&arena, csv_predicate_equals(&arena, 0, "a"), late);
+    assert(csv_predicate_matches_line(reaches_damage, line, length, config, &arena));
+
+    assert(!csv_predicate_matches_line(late, NULL, 0, config, &arena));
+    assert(csv_predicate_matches_line(NULL, line, length, config, &arena));
+
+    arena_destroy(&arena);
+    printf("✓ csv_predicate_matches_line short-circuit test passed\n");
+}
+
+void test_csv_reader_filter() {
+    printf("Testing csv_reader filter pushdown...\n");
+    FILE *file = fopen("test_filter.csv", "w");
+    assert(file != NULL);
+    fprintf(file, "id,country,amount,note\n");
+    const char *countries[] = {"FR", "DE", "US", "FRA"};
+    for (int i = 0; i < 2000; i++) {
+        fprintf(file, "%d,%s,%d.%d,\"note %d, \"\"quoted\"\"\"\n", i, countries[i % 4], i % 100, i % 10, i);
+    }
+    fclose(file);
+
+    Arena arena;
+    assert(arena_create(&arena, 64 * 1024) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_path(config, "test_filter.csv");
+    csv_config_set_has_header(config, true);
+
+    CSVReader *reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+
+    CSVPredicate *predicate = csv_predicate_and(&arena,
+        csv_predicate_prefix(&arena, 1, "FR"),
+        csv_predicate_range(&arena, 2, 10, 19.5));
+    assert(csv_reader_set_filter(reader, predicate) == 1);
+
+    int expected = 0;
+    for (int i = 0; i < 2000; i++) {
+        double amount = (i % 100) + (i % 10) / 10.0;
+        if ((i % 4 == 0 || i % 4 == 3) && amount >= 10 && amount <= 19.5) expected++;
+    }
+
+    int seen = 0;
+    CSVRecord *record;
+    while ((record = csv_reader_next_record(reader)) != NULL) {
+        int id = atoi(record->fields[0]);
+        assert(id % 4 == 0 || id % 4 == 3);
+        assert(strncmp(record->fields[1], "FR", 2) == 0);
+        assert(strtod(record->fields[2], NULL) >= 10 && strtod(record->fields[2], NULL) <= 19.5);
+        seen++;
+    }
+    assert(seen == expected && seen > 0);
+    assert(csv_reader_get_position(reader) == 2001);
+
+    const char *columns[] = {"note"};
+    assert(csv_reader_set_projection(reader, columns, 1) == 1);
+    assert(csv_reader_set_filter(reader, csv_predicate_equals(&arena, 0, "1013")) == 1);
+    csv_reader_rewind(reader);
+    CSVRecordView *view = csv_reader_next_record_view(reader);
+    assert(view != NULL && view->field_count == 1);
+    assert(strcmp(csv_reader_view_field_string(reader, view, 0), "note 1013, \"quoted\"") == 0);
+    assert(csv_reader_next_record_view(reader) == NULL);
+
+    assert(csv_reader_set_filter(reader, NULL) == 1);
+    assert(csv_reader_set_filter(NULL, predicate) == 0);
+    csv_reader_clear_projection(reader);
+    csv_reader_rewind(reader);
+    seen = 0;
+    while (csv_reader_next_record(reader) != NULL) seen++;
+    assert(seen == 2000);
+
+    csv_reader_free(reader);
+    arena_destroy(&arena);
+    remove("test_filter.csv");
+    printf("✓ csv_reader filter pushdown test passed\n");
+}
+
+int main() {
+    printf("Running CSV Filter tests...\n\n");
+    test_csv_predicate_leaves();
+    test_csv_predicate_short_circuit();
+    test_csv_reader_filter();
+    printf("\n✅ All CSV Filter tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../csv_headers.h"
+#include "../csv_reader.h"
+#include "../arena.h"
+
+void test_csv_header_map() {
+    printf("Testing csv_header_map...\n");
+    Arena arena;
+    assert(arena_create(&arena, 64 * 1024) == ARENA_OK);
+
+    char *names[300];
+    char storage[300][16];
+    for (int i = 0; i < 300; i++) {
+        snprintf(storage[i], sizeof(storage[i]), "col_%d", i);
+        names[i] = storage[i];
+    }
+    strcpy(storage[250], "col_7");
+    names[251] = NULL;
+
+    CSVHeaderMap map;
+    assert(csv_header_map_build(&map, names, 300, &arena));
+    for (int i = 0; i < 300; i++) {
+        if (i == 250 || i == 251) continue;
+        assert(csv_header_map_find(&map, storage[i]) == i);
+    }
+    assert(csv_header_map_find(&map, "col_7") == 7);
+    assert(csv_header_map_find(&map, "") == 251);
+    assert(csv_header_map_find(&map, "col_300") == -1);
+    assert(csv_header_map_find(&map, "col_") == -1);
+    assert(csv_header_map_find(&map, NULL) == -1);
+    assert(csv_header_map_find_length(&map, "col_42,rest", 6) == 42);
+    assert(csv_header_map_find_length(&map, "col_42", 5) == 4);
+
+    CSVHeaderMap empty;
+    assert(csv_header_map_build(&empty, NULL, 0, &arena));
+    assert(csv_header_map_find(&empty, "col_1") == -1);
+    csv_header_map_init(&empty);
+    assert(csv_header_map_find(&empty, "col_1") == -1);
+    assert(csv_header_map_find(NULL, "col_1") == -1);
+    assert(!csv_header_map_build(&empty, NULL, 3, &arena));
+
+    arena_destroy(&arena);
+    printf("✓ csv_header_map test passed\n");
+}
+
+void test_csv_reader_field_by_name() {
+    printf("Testing csv_reader column lookup by name...\n");
+    FILE *file = fopen("test_headers.csv", "w");
+    assert(file != NULL);
+    fputs("id,name,\"city, country\",age\n1,Alice,\"Paris, FR\",25\n2,Bob\n", file);
+    fclose(file);
+
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_path(config, "test_headers.csv");
+    csv_config_set_has_header(config, true);
+
+    CSVReader *reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+    assert(csv_reader_column_index(reader, "id") == 0);
+    assert(csv_reader_column_index(reader, "city, country") == 2);
+    assert(csv_reader_column_index(reader, "missing") == -1);
+    assert(csv_reader_column_index(NULL, "id") == -1);
+
+    CSVRecord *record = csv_reader_next_record(reader);
+    assert(record != NULL);
+    assert(strcmp(csv_reader_get_field(reader, record, "city, country"), "Paris, FR") == 0);
+    assert(strcmp(csv_reader_get_field(reader, record, "age"), "25") == 0);
+    assert(csv_reader_get_field(reader, record, "missing") == NULL);
+    assert(csv_reader_get_field(reader, NULL, "age") == NULL);
+
+    record = csv_reader_next_record(reader);
+    assert(record != NULL);
+    assert(strcmp(csv_reader_get_field(reader, record, "name"), "Bob") == 0);
+    assert(csv_reader_get_field(reader, record, "age") == NULL);
+
+    const char *columns[] = {"age", "id"};
+    assert(csv_reader_set_projection(reader, columns, 2) == 1);
+    csv_reader_rewind(reader);
+    record = csv_reader_next_record(reader);
+    assert(record != NULL && record->field_count == 2);
+    assert(strcmp(csv_reader_get_field(reader, record, "id"), "1") == 0);
+    assert(strcmp(csv_reader_get_field(reader, record, "age"), "25") == 0);
+    assert(csv_reader_get_field(reader, record, "name") == NULL);
+    csv_reader_free(reader);
+
+    csv_config_set_has_header(config, false);
+    reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+    assert(csv_reader_column_index(reader, "id") == -1);
+    csv_reader_free(reader);
+
+    arena_destroy(&arena);
+    remove("test_headers.csv");
+    printf("✓ csv_reader column lookup by name test passed\n");
+}
+
+int main() {
+    printf("Running CSV Headers tests...\n\n");
+    test_csv_header_map();
+    test_csv_reader_field_by_name();
+    printf("\n✅ All CSV Headers tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,165 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../csv_index.h"
+
+static void write_test_file(const char *filename, const char *content, size_t length) {
+    FILE *file = fopen(filename, "wb");
+    assert(file != NULL);
+    fwrite(content, 1, length, file);
+    fclose(file);
+}
+
+static void write_rows(const char *filename, int rows) {
+    FILE *file = fopen(filename, "wb");
+    assert(file != NULL);
+    for (int i = 0; i < rows; i++) {
+        if (i % 7 == 3) {
+            fprintf(file, "%d,\"quoted\nnewline\"\r\n", i);
+        } else {
+            fprintf(file, "%d,plain\n", i);
+        }
+    }
+    fclose(file);
+}
+
+void test_csv_index_build_and_lookup() {
+    printf("Testing csv_index_build and csv_index_lookup...\n");
+    write_rows("test_index_build.csv", 100);
+
+    CSVBuffer buffer;
+    assert(csv_buffer_open(&buffer, "test_index_build.csv", 64) == CSV_BUFFER_OK);
+
+    CSVRecordIndex index;
+    csv_index_init(&index);
+    assert(!csv_index_is_built(&index));
+    assert(csv_index_build(&index, &buffer, '"', 10) == CSV_INDEX_OK);
+    assert(csv_index_is_built(&index));
+    assert(index.record_count == 100);
+    assert(index.count == 10);
+    assert(index.offsets[0] == 0);
+
+    for (long record = 0; record < 100; record += 13) {
+        off_t offset;
+        long remaining;
+        assert(csv_index_lookup(&index, record, &offset, &remaining));
+        assert(remaining == record % 10);
+
+        assert(csv_buffer_seek(&buffer, offset) == CSV_BUFFER_OK);
+        for (long i = 0; i < remaining; i++) {
+            assert(csv_buffer_next_record(&buffer, '"', NULL) != NULL);
+        }
+        const char *line = csv_buffer_next_record(&buffer, '"', NULL);
+        assert(line != NULL);
+        assert(atol(line) == record);
+    }
+
+    off_t offset;
+    long remaining;
+    assert(csv_index_lookup(&index, 250, &offset, &remaining));
+    assert(offset == index.offsets[index.count - 1] && remaining == 160);
+    assert(!csv_index_lookup(&index, -1, &offset, &remaining));
+
+    csv_index_free(&index);
+    assert(!csv_index_lookup(&index, 0, &offset, &remaining));
+    csv_buffer_close(&buffer);
+    remove("test_index_build.csv");
+    printf("✓ csv_index_build and csv_index_lookup test passed\n");
+}
+
+void test_csv_index_save_and_load() {
+    printf("Testing csv_index_save and csv_index_load...\n");
+    write_rows("test_index_save.csv", 50);
+
+    CSVBuffer buffer;
+    assert(csv_buffer_open_mapped(&buffer, "test_index_save.csv") == CSV_BUFFER_OK);
+
+    CSVRecordIndex index;
+    csv_index_init(&index);
+    assert(csv_index_build(&index, &buffer, '"', 8) == CSV_INDEX_OK);
+    assert(csv_index_save(&index, "test_index_save.csv.idx") == CSV_INDEX_OK);
+
+    CSVRecordIndex loaded;
+    csv_index_init(&loaded);
+    assert(csv_index_load(&loaded, "test_index_save.csv.idx", &buffer) == CSV_INDEX_OK);
+    assert(loaded.count == index.count);
+    assert(loaded.stride == 8);
+    assert(loaded.record_count == 50);
+    assert(loaded.enclosure == '"');
+    assert(memcmp(loaded.offsets, index.offsets, index.count * sizeof(off_t)) == 0);
+
+    csv_index_free(&loaded);
+    csv_index_free(&index);
+    csv_buffer_close(&buffer);
+    remove("test_index_save.csv");
+    remove("test_index_save.csv.idx");
+    printf("✓ csv_index_save and csv_index_load test passed\n");
+}
+
+void test_csv_index_stale_sidecar() {
+    printf("Testing csv_index_load rejects stale sidecars...\n");
+    write_rows("test_index_stale.csv", 30);
+
+    CSVBuffer buffer;
+    assert(csv_buffer_open(&buffer, "test_index_stale.csv", 0) == CSV_BUFFER_OK);
+    CSVRecordIndex index;
+    csv_index_init(&index);
+    assert(csv_index_build(&index, &buffer, '"', 4) == CSV_INDEX_OK);
+    assert(csv_index_save(&index, "test_index_stale.csv.idx") == CSV_INDEX_OK);
+    csv_index_free(&index);
+    csv_buffer_close(&buffer);
+
+    write_rows("test_index_stale.csv", 31);
+    assert(csv_buffer_open(&buffer, "test_index_stale.csv", 0) == CSV_BUFFER_OK);
+    assert(csv_index_load(&index, "test_index_stale.csv.idx", &buffer) == CSV_INDEX_ERROR_STALE);
+    assert(!csv_index_is_built(&index));
+
+    const char content[] = "a,b\n";
+    CSVBuffer memory;
+    assert(csv_buffer_open_memory(&memory, content, sizeof(content) - 1) == CSV_BUFFER_OK);
+    assert(csv_index_load(&index, "test_index_stale.csv.idx", &memory) == CSV_INDEX_ERROR_STALE);
+
+    csv_buffer_close(&buffer);
+    remove("test_index_stale.csv");
+    remove("test_index_stale.csv.idx");
+    printf("✓ csv_index_load stale sidecar test passed\n");
+}
+
+void test_csv_index_invalid_input() {
+    printf("Testing csv_index invalid input handling...\n");
+    write_rows("test_index_invalid.csv", 5);
+    write_test_file("test_index_invalid.csv.idx", "not an index file at all, just text\n", 36);
+
+    CSVBuffer buffer;
+    assert(csv_buffer_open(&buffer, "test_index_invalid.csv", 0) == CSV_BUFFER_OK);
+
+    CSVRecordIndex index;
+    csv_index_init(&index);
+    assert(csv_index_load(&index, "test_index_invalid.csv.idx", &buffer) == CSV_INDEX_ERROR_INVALID_FORMAT);
+    assert(csv_index_load(&index, "missing.csv.idx", &buffer) == CSV_INDEX_ERROR_FILE_OPEN);
+    assert(csv_index_build(NULL, &buffer, '"', 4) == CSV_INDEX_ERROR_NULL_POINTER);
+    assert(csv_index_build(&index, NULL, '"', 4) == CSV_INDEX_ERROR_NULL_POINTER);
+    assert(csv_index_save(&index, "test_index_unbuilt.idx") == CSV_INDEX_ERROR_NULL_POINTER);
+
+    assert(csv_index_build(&index, &buffer, '"', 0) == CSV_INDEX_OK);
+    assert(index.stride == CSV_INDEX_DEFAULT_STRIDE);
+    assert(index.count == 1 && index.record_count == 5);
+    assert(strcmp(csv_index_error_string(CSV_INDEX_ERROR_STALE), "Index does not match the source file") == 0);
+
+    csv_index_free(&index);
+    csv_buffer_close(&buffer);
+    remove("test_index_invalid.csv");
+    remove("test_index_invalid.csv.idx");
+    printf("✓ csv_index invalid input test passed\n");
+}
+
+int main() {
+    printf("Running CSV Index tests...\n\n");
+    test_csv_index_build_and_lookup();
+    test_csv_index_save_and_load();
+    test_csv_index_stale_sidecar();
+    test_csv_index_invalid_input();
+    printf("\n✅ All CSV Index tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,343 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+#include "../csv_parallel.h"
+#include "../csv_reader.h"
+#include "../csv_config.h"
+#include "../arena.h"
+
+typedef struct {
+    Arena arena;
+    uint64_t ordered_hash;
+    uint64_t worker_sums[CSV_PARALLEL_MAX_THREADS];
+    size_t worker_counts[CSV_PARALLEL_MAX_THREADS];
+    size_t stop_after;
+    size_t seen;
+} ParallelCollector;
+
+static uint64_t hash_bytes(uint64_t hash, const char *data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ (unsigned char)data[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+static uint64_t hash_record(const CSVRecordView *record, Arena *arena) {
+    uint64_t hash = 14695981039346656037ULL;
+    arena_reset(arena);
+    for (size_t i = 0; i < record->field_count; i++) {
+        char *field = csv_field_view_to_string(&record->fields[i], record->enclosure, arena);
+        assert(field != NULL);
+        hash = hash_bytes(hash, field, strlen(field));
+        hash = hash_bytes(hash, "\x1f", 1);
+    }
+    return hash;
+}
+
+static bool collect_ordered(const CSVRecordView *record, int worker, void *user_data) {
+    ParallelCollector *collector = user_data;
+    assert(worker == 0);
+    collector->ordered_hash = collector->ordered_hash * 31 + hash_record(record, &collector->arena);
+    collector->seen++;
+    return collector->stop_after == 0 || collector->seen < collector->stop_after;
+}
+
+static bool collect_unordered(const CSVRecordView *record, int worker, void *user_data) {
+    ParallelCollector *collector = user_data;
+    assert(worker >= 0 && worker < CSV_PARALLEL_MAX_THREADS);
+
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < record->field_count; i++) {
+        hash = hash_bytes(hash, record->fields[i].data, record->fields[i].length);
+    }
+    collector->worker_sums[worker] += hash;
+    collector->worker_counts[worker]++;
+    return true;
+}
+
+static size_t write_random_csv(const char *filename, unsigned int seed, size_t rows) {
+    FILE *file = fopen(filename, "wb");
+    assert(file != NULL);
+    srand(seed);
+
+    fputs("id,text,value\r\n", file);
+    for (size_t row = 0; row < rows; row++) {
+        fprintf(file, "%zu,", row);
+        switch (rand() % 5) {
+            case 0: fputs("\"multi\nline, \"\"quoted\"\"\r\ntext\"", file); break;
+            case 1: fputs("\"\"", file); break;
+            case 2: fputs("plain text", file); break;
+            case 3: fputs("\"\"\"\"", file); break;
+            default: fputs("\"comma, inside\"", file); break;
+        }
+        fprintf(file, ",%d%s", rand() % 1000, (rand() % 3 == 0) ? "\r\n" : "\n");
+    }
+    fclose(file);
+    return rows;
+}
+
+static uint64_t sequential_hash(CSVConfig *config, size_t *count) {
+    Arena arena;
+    assert(arena_create(&arena, 64 * 1024) == ARENA_OK);
+    CSVReader *reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+
+    uint64_t hash = 0;
+    *count = 0;
+    CSVRecordView *record;
+    while ((record = csv_reader_next_record_view(reader)) != NULL) {
+        hash = hash * 31 + hash_record(record, &arena);
+        (*count)++;
+    }
+
+    csv_reader_free(reader);
+    arena_destroy(&arena);
+    return hash;
+}
+
+void test_csv_parallel_ordered_matches_reader() {
+    printf("Testing csv_parallel_read ordered delivery...\n");
+    write_random_csv("test_parallel.csv", 7, 5000);
+
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_path(config, "test_parallel.csv");
+    csv_config_set_has_header(config, true);
+
+    size_t expected_count;
+    uint64_t expected_hash = sequential_hash(config, &expected_count);
+    assert(expected_count == 5000);
+
+    int thread_counts[] = { 1, 3, 8 };
+    for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); t++) {
+        CSVParallelOptions options;
+        csv_parallel_options_init(&options);
+        options.thread_count = thread_counts[t];
+        options.chunk_size = CSV_PARALLEL_MIN_CHUNK_SIZE;
+
+        ParallelCollector collector;
+        memset(&collector, 0, sizeof(collector));
+        assert(arena_create(&collector.arena, 64 * 1024) == ARENA_OK);
+
+        CSVParallelStats stats;
+        assert(csv_parallel_read(config, &options, collect_ordered, &collector, &stats) == CSV_PARALLEL_OK);
+        assert(stats.record_count == expected_count);
+        assert(stats.chunk_count > 1);
+        assert(stats.thread_count == thread_counts[t]);
+        assert(collector.seen == expected_count);
+        assert(collector.ordered_hash == expected_hash);
+
+        arena_destroy(&collector.arena);
+    }
+
+    arena_destroy(&arena);
+    remove("test_parallel.csv");
+    printf("✓ csv_parallel_read ordered delivery test passed\n");
+}
+
+void test_csv_parallel_unordered() {
+    printf("Testing csv_parallel_read unordered delivery...\n");
+    write_random_csv("test_parallel_unordered.csv", 11, 4000);
+
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_path(config, "test_parallel_unordered.csv");
+    csv_config_set_has_header(config, true);
+
+    CSVParallelOptions options;
+    csv_parallel_options_init(&options);
+    options.chunk_size = CSV_PARALLEL_MIN_CHUNK_SIZE;
+
+    ParallelCollector single;
+    memset(&single, 0, sizeof(single));
+    options.thread_count = 1;
+    options.order = CSV_PARALLEL_UNORDERED;
+    assert(csv_parallel_read(config, &options, collect_unordered, &single, NULL) == CSV_PARALLEL_OK);
+
+    ParallelCollector many;
+    memset(&many, 0, sizeof(many));
+    options.thread_count = 4;
+    CSVParallelStats stats;
+    assert(csv_parallel_read(config, &options, collect_unordered, &many, &stats) == CSV_PARALLEL_OK);
+    assert(stats.record_count == 4000);
+
+    uint64_t single_sum = 0, many_sum = 0;
+    size_t many_count = 0;
+    for (int i = 0; i < CSV_PARALLEL_MAX_THREADS; i++) {
+        single_sum += single.worker_sums[i];
+        many_sum += many.worker_sums[i];
+        many_count += many.worker_counts[i];
+    }
+    assert(single.worker_counts[0] == 4000);
+    assert(many_count == 4000);
+    assert(single_sum == many_sum);
+
+    arena_destroy(&arena);
+    remove("test_parallel_unordered.csv");
+    printf("✓ csv_parallel_read unordered delivery test passed\n");
+}
+
+void test_csv_parallel_quote_spanning_chunks() {
+    printf("Testing csv_parallel_read with quoted fields spanning chunks...\n");
+    FILE *file = fopen("test_parallel_span.csv", "wb");
+    assert(file != NULL);
+    fputs("a,b\n", file);
+    fputc('"', file);
+    for (int i = 0; i < 3 * CSV_PARALLEL_MIN_CHUNK_SIZE; i++) {
+        fputc(i % 97 == 0 ? '\n' : (i % 89 == 0 ? ',' : 'x'), file);
+    }
+    fputs("\",tail\n1,2\n\"x\"\"\n\",3", file);
+    fclose(file);
+
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_path(config, "test_parallel_span.csv");
+    csv_config_set_has_header(config, true);
+
+    size_t expected_count;
+    uint64_t expected_hash = sequential_hash(config, &expected_count);
+    assert(expected_count == 3);
+
+    CSVParallelOptions options;
+    csv_parallel_options_init(&options);
+    options.thread_count = 4;
+    options.chunk_size = CSV_PARALLEL_MIN_CHUNK_SIZE;
+
+    ParallelCollector collector;
+    memset(&collector, 0, sizeof(collector));
+    assert(arena_create(&collector.arena, 64 * 1024) == ARENA_OK);
+    assert(csv_parallel_read(config, &options, collect_ordered, &collector, NULL) == CSV_PARALLEL_OK);
+    assert(collector.seen == expected_count);
+    assert(collector.ordered_hash == expected_hash);
+
+    arena_destroy(&collector.arena);
+    arena_destroy(&arena);
+    remove("test_parallel_span.csv");
+    printf("✓ csv_parallel_read quoted fields spanning chunks test passed\n");
+}
+
+void test_csv_parallel_stop_and_errors() {
+    printf("Testing csv_parallel_read stop and error handling...\n");
+    write_random_csv("test_parallel_stop.csv", 3, 3000);
+
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_path(config, "test_parallel_stop.csv");
+    csv_config_set_has_header(config, true);
+
+    CSVParallelOptions options;
+    csv_parallel_options_init(&options);
+    options.thread_count = 4;
+    options.chunk_size = CSV_PARALLEL_MIN_CHUNK_SIZE;
+
+    ParallelCollector collector;
+    memset(&collector, 0, sizeof(collector));
+    assert(arena_create(&collector.arena, 64 * 1024) == ARENA_OK);
+    collector.stop_after = 1234;
+    CSVParallelStats stats;
+    assert(csv_parallel_read(config, &options, collect_ordered, &collector, &stats) == CSV_PARALLEL_OK);
+    assert(collector.seen == 1234);
+    assert(stats.record_count == 1234);
+    arena_destroy(&collector.arena);
+
+    FILE *file = fopen("test_parallel_bad.csv", "wb");
+    assert(file != NULL);
+    for (int i = 0; i < 2000; i++) fprintf(file, "%d,ok\n", i);
+    fputs("\"bad\"x,1\n", file);
+    for (int i = 0; i < 2000; i++) fprintf(file, "%d,ok\n", i);
+    fclose(file);
+    csv_config_set_path(config, "test_parallel_bad.csv");
+    csv_config_set_has_header(config, false);
+
+    memset(&collector, 0, sizeof(collector));
+    assert(arena_create(&collector.arena, 64 * 1024) == ARENA_OK);
+    assert(csv_parallel_read(config, &options, collect_ordered, &collector, &stats) == CSV_PARALLEL_ERROR_PARSE);
+    assert(collector.seen == 2000);
+    arena_destroy(&collector.arena);
+
+    options.order = CSV_PARALLEL_UNORDERED;
+    memset(&collector, 0, sizeof(collector));
+    assert(csv_parallel_read(config, &options, collect_unordered, &collector, NULL) == CSV_PARALLEL_ERROR_PARSE);
+
+    csv_config_set_path(config, "/dev/null");
+    assert(csv_parallel_read(config, &options, collect_unordered, &collector, &stats) == CSV_PARALLEL_OK);
+    assert(stats.record_count == 0);
+
+    csv_config_set_path(config, "does_not_exist.csv");
+    assert(csv_parallel_read(config, &options, collect_unordered, &collector, NULL) == CSV_PARALLEL_ERROR_FILE_OPEN);
+    assert(csv_parallel_read(NULL, &options, collect_unordered, &collector, NULL) == CSV_PARALLEL_ERROR_NULL_POINTER);
+    assert(csv_parallel_read(config, &options, NULL, &collector, NULL) == CSV_PARALLEL_ERROR_NULL_POINTER);
+    assert(strcmp(csv_parallel_error_string(CSV_PARALLEL_ERROR_PARSE), "Malformed CSV record") == 0);
+
+    arena_destroy(&arena);
+    remove("test_parallel_stop.csv");
+    remove("test_parallel_bad.csv");
+    printf("✓ csv_parallel_read stop and error handling test passed\n");
+}
+
+void test_csv_parallel_count() {
+    printf("Testing csv_parallel_count...\n");
+    FILE *file = fopen("test_parallel_count.csv", "wb");
+    assert(file != NULL);
+    fputs("id,text\n", file);
+    for (int i = 0; i < 6000; i++) {
+        if (i % 25 == 0) {
+            fputs(" \r\n", file);
+        } else if (i % 4 == 0) {
+            fprintf(file, "%d,\"quoted\r\n\n,line\"\r\n", i);
+        } else {
+            fprintf(file, "%d,plain\n", i);
+        }
+    }
+    fclose(file);
+
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_path(config, "test_parallel_count.csv");
+    csv_config_set_has_header(config, true);
+
+    CSVParallelOptions options;
+    csv_parallel_options_init(&options);
+    options.thread_count = 4;
+    options.chunk_size = CSV_PARALLEL_MIN_CHUNK_SIZE;
+
+    long count = 0;
+    assert(csv_parallel_count(config, &options, &count) == CSV_PARALLEL_OK);
+    assert(count == 6000);
+
+    csv_config_set_skip_empty_lines(config, true);
+    assert(csv_parallel_count(config, &options, &count) == CSV_PARALLEL_OK);
+    assert(count == 6000 - 240);
+    assert(csv_parallel_count(config, NULL, &count) == CSV_PARALLEL_OK);
+    assert(count == 6000 - 240);
+
+    csv_config_set_path(config, "/dev/null");
+    assert(csv_parallel_count(config, &options, &count) == CSV_PARALLEL_OK);
+    assert(count == 0);
+    csv_config_set_path(config, "does_not_exist.csv");
+    assert(csv_parallel_count(config, &options, &count) == CSV_PARALLEL_ERROR_FILE_OPEN);
+    assert(csv_parallel_count(NULL, &options, &count) == CSV_PARALLEL_ERROR_NULL_POINTER);
+    assert(csv_parallel_count(config, &options, NULL) == CSV_PARALLEL_ERROR_NULL_POINTER);
+
+    arena_destroy(&arena);
+    remove("test_parallel_count.csv");
+    printf("✓ csv_parallel_count test passed\n");
+}
+
+int main() {
+    printf("Running CSV Parallel tests...\n\n");
+    test_csv_parallel_ordered_matches_reader();
+    test_csv_parallel_unordered();
+    test_csv_parallel_quote_spanning_chunks();
+    test_csv_parallel_stop_and_errors();
+    test_csv_parallel_count();
+    printf("\n✅ All CSV Parallel tests passed!\n");
+    return 0;
+}
@@ -3,6 +3,8 @@
 #include <string.h>
 #include <assert.h>
 #include "../csv_parser.h"
+#include "../csv_simd.h"
+#include "../csv_buffer.h"
 #include "../csv_config.h"
 #include "../arena.h"
 
@@ -158,6 +160,44 @@ void test_csv_parser_custom_delimiters() {
     printf("✓ CSV parser custom delimiters test passed\n");
 }
 
+void test_csv_parser_field_views() {
+    printf("Testing CSV parser field views...\n");
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+
+    const char *line = "plain,\"quoted, text\",\"say \"\"hi\"\"\",trailing  ,";
+    CSVParseViewResult result = csv_parse_line_views(line, strlen(line), &arena, config, 1);
+    assert(result.success == true);
+    assert(result.fields.count == 5);
+
+    CSVFieldView *views = result.fields.fields;
+    assert(views[0].data == line);
+    assert(views[0].length == 5);
+    assert(views[0].needs_unescape == false);
+
+    assert(views[1].data == line + 7);
+    assert(views[1].length == strlen("quoted, text"));
+    assert(views[1].needs_unescape == false);
+
+    assert(views[2].needs_unescape == true);
+    char *unescaped = csv_field_view_to_string(&views[2], '"', &arena);
+    assert(strcmp(unescaped, "say \"hi\"") == 0);
+
+    assert(views[3].length == strlen("trailing"));
+    assert(strncmp(views[3].data, "trailing", views[3].length) == 0);
+    assert(views[4].length == 0);
+
+    CSVParseViewResult error = csv_parse_line_views("\"open", 5, &arena, config, 2);
+    assert(error.success == false);
+    assert(strcmp(error.error, "Unclosed quote") == 0);
+
+    assert(csv_field_view_to_string(NULL, '"', &arena) == NULL);
+
+    arena_destroy(&arena);
+    printf("✓ CSV parser field views test passed\n");
+}
+
 void test_read_full_record() {
     printf("Testing read_full_record function...\n");
     
@@ -193,12 +233,59 @@ void test_read_full_record() {
     // No more records
     char *record4 = read_full_record(test_file, &arena);
     assert(record4 == NULL);
+
     
     fclose(test_file);
     arena_destroy(&arena);
     printf("✓ read_full_record test passed\n");
 }
 
+void test_read_full_record_growth() {
+    printf("Testing read_full_record and field array growth without copies...\n");
+    const size_t long_length = 1024 * 1024;
+    FILE *test_file = tmpfile();
+    assert(test_file != NULL);
+    fputc('"', test_file);
+    for (size_t i = 0; i < long_length; i++) {
+        fputc(i % 100 == 99 ? '\n' : 'x', test_file);
+    }
+    fputs("\"\nnext\n", test_file);
+    rewind(test_file);
+    
+    Arena arena;
+    assert(arena_create_growable(&arena, 4096, 0) == ARENA_OK);
+    char *record = read_full_record(test_file, &arena);
+    assert(record != NULL);
+    assert(strlen(record) == long_length + 2);
+    assert(arena_get_used_size(&arena) == ((long_length + 3 + 7) & ~(size_t)7));
+    assert(arena.total_size < 5 * long_length);
+    
+    char *next = read_full_record(test_file, &arena);
+    assert(next != NULL && strcmp(next, "next") == 0);
+    assert(read_full_record(test_file, &arena) == NULL);
+    fclose(test_file);
+    arena_destroy(&arena);
+    
+    Arena config_arena;
+    assert(arena_create(&config_arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&config_arena);
+    char line[4000];
+    for (int i = 0; i < 1000; i++) {
+        memcpy(line + i * 2, "a,", 2);
+    }
+    line[1999] = '\0';
+    
+    assert(arena_create(&arena, 64 * 1024) == ARENA_OK);
+    CSVParseViewResult views = csv_parse_line_views(line, strlen(line), &arena, config, 1);
+    assert(views.success);
+    assert(views.fields.count == 1000);
+    assert(arena_get_used_size(&arena) == sizeof(CSVFieldView) * views.fields.capacity);
+    
+    arena_destroy(&arena);
+    arena_destroy(&config_arena);
+    printf("✓ read_full_record and field array growth test passed\n");
+}
+
 void test_csv_parser_memory_allocation_errors() {
     printf("Testing CSV parser memory allocation error handling...\n");
     Arena arena;
@@ -222,6 +309,341 @@ void test_csv_parser_memory_allocation_errors() {
     printf("✓ CSV parser memory allocation error handling test passed\n");
 }
 
+static void assert_same_parse(const char *line, Arena *arena, const CSVConfig *config) {
+    CSVSimdLevel detected = csv_simd_detect_level();
+
+    csv_simd_set_level(CSV_SIMD_DISABLED);
+    CSVParseResult expected = csv_parse_line_inplace(line, arena, config, 1);
+
+    for (int level = CSV_SIMD_SCALAR; level <= (int)detected; level++) {
+        csv_simd_set_level((CSVSimdLevel)level);
+        CSVParseResult actual = csv_parse_line_inplace(line, arena, config, 1);
+        assert(actual.success == expected.success);
+        if (!expected.success) {
+            assert(strcmp(actual.error, expected.error) == 0);
+            continue;
+        }
+        assert(actual.fields.count == expected.fields.count);
+        for (size_t i = 0; i < expected.fields.count; i++) {
+            assert(strcmp(actual.fields.fields[i], expected.fields.fields[i]) == 0);
+        }
+
+        CSVParseViewResult views = csv_parse_line_views(line, strlen(line), arena, config, 1);
+        assert(views.success);
+        assert(views.fields.count == expected.fields.count);
+        for (size_t i = 0; i < expected.fields.count; i++) {
+            char *field = csv_field_view_to_string(&views.fields.fields[i], config->enclosure, arena);
+            assert(field && strcmp(field, expected.fields.fields[i]) == 0);
+        }
+    }
+
+    csv_simd_set_level(detected);
+}
+
+void test_csv_parser_indexed_matches_scalar() {
+    printf("Testing indexed parser against scalar state machine...\n");
+    Arena arena;
+    assert(arena_create(&arena, 1024 * 1024) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+
+    const char *lines[] = {
+        "", ",", "a", "a,", ",a", "a,b,c", "a,,c", ",,",
+        "\"\"", "a,\"\"", "\"\",a", "a,\"\",c", "\"a,b\",\"c\"",
+        "\"Say \"\"Hello\"\" World\",normal", "\"\"\"quoted\"\"\",\"test\"",
+        "  field1  ,  field2  ,  field3  ", "\"  field1  \",  field2  ",
+        "field1   ,field2\t\t,field3 ", "ab\"c,d", " \"a\",b", "\"a\" ,b",
+        "\"a\"x,b", "\"a,b,c", "\"a\"\r", "a,\"multi\nline\",b",
+        "0123456789012345678901234567890123456789012345678901234567890,\"quoted field crossing the block boundary, with commas\",tail",
+        "\"0123456789012345678901234567890123456789012345678901234567890\",\"\"",
+        "012345678901234567890123456789012345678901234567890123456789012,x",
+        "0123456789012345678901234567890123456789012345678901234567890\"2,x",
+    };
+
+    for (size_t i = 0; i < sizeof(lines) / sizeof(lines[0]); i++) {
+        arena_reset(&arena);
+        config = csv_config_create(&arena);
+        assert_same_parse(lines[i], &arena, config);
+    }
+
+    const char alphabet[] = "abc,,,\"\" \t;";
+    char line[300];
+    srand(1234);
+    for (int iteration = 0; iteration < 5000; iteration++) {
+        size_t len = (size_t)(rand() % (int)(sizeof(line) - 1));
+        for (size_t i = 0; i < len; i++) {
+            line[i] = alphabet[rand() % (sizeof(alphabet) - 1)];
+        }
+        line[len] = '\0';
+
+        arena_reset(&arena);
+        config = csv_config_create(&arena);
+        if (iteration & 1) {
+            csv_config_set_delimiter(config, ';');
+        }
+        assert_same_parse(line, &arena, config);
+    }
+
+    arena_destroy(&arena);
+    printf("✓ Indexed parser matches scalar state machine\n");
+}
+
+void test_csv_parser_projection() {
+    printf("Testing projected parsing...\n");
+    Arena arena;
+    assert(arena_create(&arena, 1024 * 1024) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+
+    int slots[] = {-1, 1, -1, 0};
+    CSVProjection projection = { slots, 4, 2 };
+    CSVParseResult result = csv_parse_record_projected("a,\"b\"\"x\",c,  d  ,e", 19, &arena, config, 1, &projection);
+    assert(result.success && result.fields.count == 2);
+    assert(strcmp(result.fields.fields[0], "  d") == 0);
+    assert(strcmp(result.fields.fields[1], "b\"x") == 0);
+
+    result = csv_parse_record_projected("a,b", 3, &arena, config, 1, &projection);
+    assert(result.success && result.fields.count == 2);
+    assert(strcmp(result.fields.fields[0], "") == 0);
+    assert(strcmp(result.fields.fields[1], "b") == 0);
+
+    /* Parsing stops once every projected column is in, so later damage is never seen. */
+    result = csv_parse_record_projected("a,b,c,d,\"unclosed", 18, &arena, config, 1, &projection);
+    assert(result.success && strcmp(result.fields.fields[0], "d") == 0);
+
+    const char alphabet[] = "abc,,,\"\" \t";
+    char line[200];
+    CSVSimdLevel detected = csv_simd_detect_level();
+    srand(4321);
+    for (int iteration = 0; iteration < 4000; iteration++) {
+        size_t len = (size_t)(rand() % (int)(sizeof(line) - 1));
+        for (size_t i = 0; i < len; i++) {
+            line[i] = alphabet[rand() % (sizeof(alphabet) - 1)];
+        }
+        line[len] = '\0';
+
+        int random_slots[12];
+        int sources[12];
+        size_t output_count = 0;
+        for (int column = 0; column < 12; column++) {
+            random_slots[column] = -1;
+        }
+        for (int pick = 0; pick < 4; pick++) {
+            int column = rand() % 12;
+            if (random_slots[column] >= 0) continue;
+            random_slots[column] = (int)output_count;
+            sources[output_count++] = column;
+        }
+        CSVProjection random_projection = { random_slots, 12, output_count };
+
+        arena_reset(&arena);
+        config = csv_config_create(&arena);
+        csv_simd_set_level((CSVSimdLevel)(iteration % ((int)detected + 1)));
+
+        CSVParseResult full = csv_parse_record(line, len, &arena, config, 1);
+        if (!full.success) continue;
+        CSVParseResult projected = csv_parse_record_projected(line, len, &arena, config, 1, &random_projection);
+        CSVParseViewResult views = csv_parse_line_views_projected(line, len, &arena, config, 1, &random_projection);
+        assert(projected.success && projected.fields.count == output_count);
+        assert(views.success && views.fields.count == output_count);
+
+        for (size_t i = 0; i < output_count; i++) {
+            const char *expected = (size_t)sources[i] < full.fields.count ? full.fields.fields[sources[i]] : "";
+            assert(strcmp(projected.fields.fields[i], expected) == 0);
+            char *from_view = csv_field_view_to_string(&views.fields.fields[i], config->enclosure, &arena);
+            assert(from_view && strcmp(from_view, expected) == 0);
+        }
+    }
+
+    csv_simd_set_level(detected);
+    arena_destroy(&arena);
+    printf("✓ Projected parsing test passed\n");
+}
+
+void test_csv_parser_scan_record() {
+    printf("Testing single-pass record scanning...\n");
+    Arena arena;
+    assert(arena_create(&arena, 1024 * 1024) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+
+    const char *data = "a,\"b,\r\n\"\"c\"  ,d\r\nnext";
+    CSVRecordExtent extent;
+    CSVParseResult result = csv_scan_record_projected(data, strlen(data), false, &arena, config, 1, NULL, &extent);
+    assert(extent.status == CSV_SCAN_COMPLETE && result.success);
+    assert(extent.length == 15 && extent.consumed == 17);
+    assert(result.fields.count == 3);
+    assert(strcmp(result.fields.fields[1], "b,\r\n\"c") == 0);
+
+    /* A '\r' at the end of unfinished input may still pair with a '\n'. */
+    csv_scan_record_projected(data, 16, false, &arena, config, 1, NULL, &extent);
+    assert(extent.status == CSV_SCAN_INCOMPLETE);
+    csv_scan_record_projected(data, 16, true, &arena, config, 1, NULL, &extent);
+    assert(extent.status == CSV_SCAN_COMPLETE && extent.consumed == 16);
+    csv_scan_record_projected(data, 6, false, &arena, config, 1, NULL, &extent);
+    assert(extent.status == CSV_SCAN_INCOMPLETE);
+
+    csv_scan_record_projected("a\"b,c\n", 6, true, &arena, config, 1, NULL, &extent);
+    assert(extent.status == CSV_SCAN_IRREGULAR);
+    csv_scan_record_projected("\"a\"b,c\n", 7, true, &arena, config, 1, NULL, &extent);
+    assert(extent.status == CSV_SCAN_IRREGULAR);
+
+    int slots[] = {0};
+    CSVProjection projection = { slots, 1, 1 };
+    CSVParseViewResult views = csv_scan_record_views_projected("x,\"y\nz\",w\nq", 11, true, &arena, config, 1,
+                                                               &projection, &extent);
+    assert(extent.status == CSV_SCAN_COMPLETE && extent.length == 9);
+    assert(views.fields.count == 1 && views.fields.fields[0].length == 1);
+
+    /* Whatever the scan completes must match framing plus split_line. */
+    const char alphabet[] = "ab,,\"\"\n\r \t";
+    char input[120];
+    srand(2468);
+    for (int iteration = 0; iteration < 20000; iteration++) {
+        size_t len = (size_t)(rand() % (int)sizeof(input));
+        for (size_t i = 0; i < len; i++) {
+            input[i] = alphabet[rand() % (sizeof(alphabet) - 1)];
+        }
+
+        CSVBuffer buffer;
+        assert(csv_buffer_open_memory(&buffer, input, len) == CSV_BUFFER_OK);
+        size_t offset = 0;
+        size_t line_length;
+        const char *line;
+        while ((line = csv_buffer_next_record(&buffer, '"', &line_length)) != NULL) {
+            arena_reset(&arena);
+            config = csv_config_create(&arena);
+            CSVParseResult expected = csv_parse_record(line, line_length, &arena, config, 1);
+            result = csv_scan_record_projected(input + offset, len - offset, true, &arena, config, 1, NULL, &extent);
+            assert(extent.status != CSV_SCAN_INCOMPLETE);
+            if (extent.status == CSV_SCAN_COMPLETE) {
+                assert(expected.success);
+                assert(extent.length == line_length && offset + extent.consumed == buffer.start);
+                assert(result.fields.count == expected.fields.count);
+                for (size_t i = 0; i < result.fields.count; i++) {
+                    assert(strcmp(result.fields.fields[i], expected.fields.fields[i]) == 0);
+                }
+            }
+            offset = buffer.start;
+        }
+        csv_buffer_close(&buffer);
+    }
+
+    arena_destroy(&arena);
+    printf("✓ Single-pass record scanning test passed\n");
+}
+
+void test_csv_parser_table() {
+    printf("Testing table-driven parser...\n");
+    Arena arena;
+    assert(arena_create(&arena, 1024 * 1024) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+    CSVSimdLevel detected = csv_simd_detect_level();
+    csv_simd_set_level(CSV_SIMD_DISABLED);
+
+    CSVParser *parser = csv_parser_init(&arena, config);
+    assert(parser != NULL && parser->config == config);
+    assert(parser->table.delimiter == ',' && parser->table.enclosure == '"');
+    assert(parser->table.classes['a'] != parser->table.classes[',']);
+    assert(parser->table.classes['a'] == parser->table.classes['z']);
+
+    const char *line = "a, \"b,\"c\"\"d\" \t,,\"\"";
+    CSVParseResult cached = csv_parser_parse_record(parser, line, strlen(line), &arena, 1, NULL);
+    CSVParseResult direct = csv_parse_record(line, strlen(line), &arena, config, 1);
+    assert(cached.success && direct.success);
+    assert(cached.fields.count == 4 && direct.fields.count == 4);
+    assert(strcmp(cached.fields.fields[1], " \"b") == 0);
+    assert(strcmp(cached.fields.fields[2], "c\"d") == 0);
+    assert(strcmp(cached.fields.fields[3], "") == 0);
+    for (size_t i = 0; i < cached.fields.count; i++) {
+        assert(strcmp(cached.fields.fields[i], direct.fields.fields[i]) == 0);
+    }
+
+    CSVParseViewResult views = csv_parser_parse_views(parser, "\"x\"y", 4, &arena, 7, NULL);
+    assert(!views.success && views.error_line == 7 && views.error_column == 3);
+    views = csv_parser_parse_views(parser, "a,\"open", 7, &arena, 1, NULL);
+    assert(!views.success && strcmp(views.error, "Unclosed quote") == 0);
+
+    /* The cached table follows dialect changes made through the config. */
+    csv_config_set_delimiter(config, ';');
+    csv_config_set_enclosure(config, '\'');
+    cached = csv_parser_parse_record(parser, "a;'b;c';d", 9, &arena, 1, NULL);
+    assert(cached.success && cached.fields.count == 3);
+    assert(strcmp(cached.fields.fields[1], "b;c") == 0);
+    assert(parser->table.delimiter == ';' && parser->table.enclosure == '\'');
+
+    /* A delimiter that is also the enclosure opens quotes at field start and splits elsewhere. */
+    csv_config_set_delimiter(config, '\'');
+    cached = csv_parser_parse_record(parser, "a'b''c'", 7, &arena, 1, NULL);
+    assert(cached.success && cached.fields.count == 3);
+    assert(strcmp(cached.fields.fields[0], "a") == 0);
+    assert(strcmp(cached.fields.fields[1], "b") == 0);
+
+    assert(csv_parser_init(NULL, config) == NULL);
+    assert(csv_parser_init(&arena, NULL) == NULL);
+    assert(!csv_parser_parse_record(NULL, "a", 1, &arena, 1, NULL).success);
+    csv_parser_free(parser);
+
+    csv_simd_set_level(detected);
+    arena_destroy(&arena);
+    printf("✓ Table-driven parser test passed\n");
+}
+
+void test_csv_parser_scan_dialects() {
+    printf("Testing record scanning across dialects...\n");
+    Arena arena;
+    assert(arena_create(&arena, 1024 * 1024) == ARENA_OK);
+
+    const char dialects[][2] = {{',', '"'}, {';', '"'}, {'|', '"'}, {'\t', '"'}, {':', '\''}};
+    char data[300];
+    srand(4321);
+    for (size_t d = 0; d < sizeof(dialects) / sizeof(dialects[0]); d++) {
+        Arena setup;
+        assert(arena_create(&setup, 4096) == ARENA_OK);
+        CSVConfig *config = csv_config_create(&setup);
+        csv_config_set_delimiter(config, dialects[d][0]);
+        csv_config_set_enclosure(config, dialects[d][1]);
+        CSVParser *parser = csv_parser_init(&setup, config);
+
+        char alphabet[] = "abxxxx \n\r";
+        alphabet[2] = dialects[d][0];
+        alphabet[3] = dialects[d][0];
+        alphabet[4] = dialects[d][1];
+        alphabet[5] = dialects[d][1];
+
+        for (int iteration = 0; iteration < 3000; iteration++) {
+            size_t len = (size_t)(rand() % (int)sizeof(data));
+            for (size_t i = 0; i < len; i++) {
+                data[i] = alphabet[rand() % (sizeof(alphabet) - 1)];
+            }
+
+            arena_reset(&arena);
+            CSVRecordExtent extent;
+            CSVRecordExtent direct;
+            CSVParseResult scanned = csv_parser_scan_record(parser, data, len, true, &arena, 1, NULL, &extent);
+            csv_scan_record_projected(data, len, true, &arena, config, 1, NULL, &direct);
+            assert(extent.status == direct.status);
+            if (extent.status != CSV_SCAN_COMPLETE) {
+                assert(extent.status == CSV_SCAN_IRREGULAR);
+                continue;
+            }
+            assert(extent.length == direct.length && extent.consumed == direct.consumed);
+
+            CSVParseResult parsed = csv_parse_record(data, extent.length, &arena, config, 1);
+            assert(scanned.success && parsed.success);
+            assert(scanned.fields.count == parsed.fields.count);
+            for (size_t i = 0; i < parsed.fields.count; i++) {
+                assert(strcmp(scanned.fields.fields[i], parsed.fields.fields[i]) == 0);
+            }
+        }
+        arena_destroy(&setup);
+    }
+
+    CSVRecordExtent extent;
+    assert(!csv_parser_scan_views(NULL, "a", 1, true, &arena, 1, NULL, &extent).success);
+    assert(extent.status == CSV_SCAN_IRREGULAR);
+
+    arena_destroy(&arena);
+    printf("✓ Record scanning across dialects test passed\n");
+}
+
 int main() {
     printf("Running CSV Parser tests...\n\n");
     test_csv_parser_optimized();
@@ -229,8 +651,15 @@ int main() {
     test_csv_parser_whitespace_trimming();
     test_csv_parser_empty_fields();
     test_csv_parser_custom_delimiters();
+    test_csv_parser_field_views();
     test_read_full_record();
+    test_read_full_record_growth();
     test_csv_parser_memory_allocation_errors();
+    test_csv_parser_indexed_matches_scalar();
+    test_csv_parser_projection();
+    test_csv_parser_scan_record();
+    test_csv_parser_table();
+    test_csv_parser_scan_dialects();
     printf("\n✅ All CSV Parser tests passed!\n");
     return 0;
 } 
\ No newline at end of file
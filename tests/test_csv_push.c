@@ -0,0 +1,201 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../csv_push.h"
+#include "../arena.h"
+
+typedef struct {
+    char output[4096];
+    size_t length;
+    int records;
+    int last_line;
+    int stop_after;
+} Collector;
+
+/* Flattens records as "a|b|c;" so every chunking can be compared with one string. */
+static bool collect(const CSVRecord *record, int line_number, void *user_data) {
+    Collector *collector = (Collector*)user_data;
+    for (size_t i = 0; i < record->field_count; i++) {
+        size_t length = strlen(record->fields[i]);
+        assert(collector->length + length + 2 < sizeof(collector->output));
+        memcpy(collector->output + collector->length, record->fields[i], length);
+        collector->length += length;
+        collector->output[collector->length++] = i + 1 < record->field_count ? '|' : ';';
+    }
+    collector->output[collector->length] = '\0';
+    collector->records++;
+    collector->last_line = line_number;
+    return collector->stop_after == 0 || collector->records < collector->stop_after;
+}
+
+static void push_in_chunks(const CSVConfig *config, const char *input, size_t chunk, Collector *collector) {
+    memset(collector, 0, sizeof(Collector));
+    CSVPushParser *parser = csv_push_parser_create(config, collect, collector);
+    assert(parser != NULL);
+
+    size_t length = strlen(input);
+    for (size_t offset = 0; offset < length; offset += chunk) {
+        size_t size = length - offset < chunk ? length - offset : chunk;
+        assert(csv_push_parser_feed(parser, input + offset, size) == CSV_PUSH_OK);
+    }
+    assert(csv_push_parser_finish(parser) == CSV_PUSH_OK);
+    csv_push_parser_free(parser);
+}
+
+void test_csv_push_parser_chunk_boundaries() {
+    printf("Testing csv_push_parser at every chunk size...\n");
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+
+    const char *input =
+        "id,name,note\r\n"
+        "1,\"Smith, John\",\"said \"\"hi\"\"\"\r\n"
+        "2,\"multi\r\nline\",plain\n"
+        "3,,\"\"\"\"\r"
+        "4,last,\"x\"";
+    const char *expected =
+        "id|name|note;"
+        "1|Smith, John|said \"hi\";"
+        "2|multi\r\nline|plain;"
+        "3||\";"
+        "4|last|x;";
+
+    Collector collector;
+    for (size_t chunk = 1; chunk <= strlen(input); chunk++) {
+        push_in_chunks(config, input, chunk, &collector);
+        assert(strcmp(collector.output, expected) == 0);
+        assert(collector.records == 5 && collector.last_line == 5);
+    }
+
+    push_in_chunks(config, "a,b\r\n\r\nc,d\r\n", 1, &collector);
+    assert(strcmp(collector.output, "a|b;;c|d;") == 0);
+    csv_config_set_skip_empty_lines(config, true);
+    push_in_chunks(config, "a,b\r\n\r\nc,d\r\n", 1, &collector);
+    assert(strcmp(collector.output, "a|b;c|d;") == 0);
+    assert(collector.last_line == 3);
+
+    csv_config_set_delimiter(config, ';');
+    csv_config_set_enclosure(config, '\'');
+    push_in_chunks(config, "a;'b;c'\nd;'it''s'", 3, &collector);
+    assert(strcmp(collector.output, "a|b;c;d|it's;") == 0);
+
+    arena_destroy(&arena);
+    printf("✓ csv_push_parser chunk boundaries test passed\n");
+}
+
+static bool check_generated(const CSVRecord *record, int line_number, void *user_data) {
+    int *records = (int*)user_data;
+    if (line_number == 20001) {
+        assert(record->field_count == 1 && strlen(record->fields[0]) == 69998);
+    } else {
+        char expected[64];
+        int i = line_number - 1;
+        snprintf(expected, sizeof(expected), "field %d, \"q\"", i);
+        assert(record->field_count == 3);
+        assert(atoi(record->fields[0]) == i);
+        assert(strcmp(record->fields[1], expected) == 0);
+        assert(strcmp(record->fields[2], i % 7 ? "x" : "") == 0);
+    }
+    (*records)++;
+    return true;
+}
+
+void test_csv_push_parser_large_input() {
+    printf("Testing csv_push_parser with large fragmented input...\n");
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+
+    /* The last record is longer than any single feed and must be stitched together. */
+    size_t capacity = 2 * 1024 * 1024;
+    char *input = malloc(capacity);
+    assert(input != NULL);
+    size_t length = 0;
+    for (int i = 0; i < 20000; i++) {
+        length += snprintf(input + length, capacity - length, "%d,\"field %d, \"\"q\"\"\",%s\n", i, i, i % 7 ? "x" : "");
+    }
+    memset(input + length, 'w', 69998);
+    length += 69998;
+
+    int records = 0;
+    CSVPushParser *parser = csv_push_parser_create(config, check_generated, &records);
+    assert(parser != NULL);
+
+    size_t sizes[] = {1, 7, 4096, 13, 65536, 3, 0};
+    size_t offset = 0;
+    for (int i = 0; offset < length; i++) {
+        size_t size = sizes[i % 7];
+        if (size > length - offset) size = length - offset;
+        assert(csv_push_parser_feed(parser, input + offset, size) == CSV_PUSH_OK);
+        offset += size;
+    }
+    assert(records == 20000);
+
+    assert(csv_push_parser_finish(parser) == CSV_PUSH_OK);
+    assert(records == 20001);
+    assert(csv_push_parser_feed(parser, "x\n", 2) == CSV_PUSH_ERROR_FINISHED);
+    assert(csv_push_parser_finish(parser) == CSV_PUSH_ERROR_FINISHED);
+    csv_push_parser_free(parser);
+
+    free(input);
+    arena_destroy(&arena);
+    printf("✓ csv_push_parser large input test passed\n");
+}
+
+void test_csv_push_parser_errors() {
+    printf("Testing csv_push_parser errors and stopping...\n");
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+
+    Collector collector;
+    memset(&collector, 0, sizeof(collector));
+    CSVPushParser *parser = csv_push_parser_create(config, collect, &collector);
+    assert(parser != NULL);
+    assert(csv_push_parser_feed(parser, "a,b\nc,\"d\"x\ne,f\n", 15) == CSV_PUSH_ERROR_PARSE);
+    assert(collector.records == 1);
+    int line = 0;
+    int column = 0;
+    assert(csv_push_parser_error(parser, &line, &column) != NULL);
+    assert(line == 2 && column == 5);
+    assert(csv_push_parser_feed(parser, "g\n", 2) == CSV_PUSH_ERROR_PARSE);
+    csv_push_parser_free(parser);
+
+    memset(&collector, 0, sizeof(collector));
+    parser = csv_push_parser_create(config, collect, &collector);
+    assert(csv_push_parser_feed(parser, "a,\"open", 7) == CSV_PUSH_OK);
+    assert(csv_push_parser_error(parser, NULL, NULL) == NULL);
+    assert(csv_push_parser_finish(parser) == CSV_PUSH_ERROR_PARSE);
+    assert(collector.records == 0);
+    csv_push_parser_free(parser);
+
+    memset(&collector, 0, sizeof(collector));
+    collector.stop_after = 2;
+    parser = csv_push_parser_create(config, collect, &collector);
+    assert(csv_push_parser_feed(parser, "1\n2\n3\n", 6) == CSV_PUSH_STOPPED);
+    assert(collector.records == 2);
+    assert(csv_push_parser_finish(parser) == CSV_PUSH_STOPPED);
+    csv_push_parser_free(parser);
+
+    assert(csv_push_parser_create(NULL, collect, NULL) == NULL);
+    assert(csv_push_parser_create(config, NULL, NULL) == NULL);
+    assert(csv_push_parser_feed(NULL, "a", 1) == CSV_PUSH_ERROR_NULL_POINTER);
+    assert(csv_push_parser_finish(NULL) == CSV_PUSH_ERROR_NULL_POINTER);
+    assert(csv_push_parser_error(NULL, NULL, NULL) == NULL);
+    csv_push_parser_free(NULL);
+    assert(strcmp(csv_push_error_string(CSV_PUSH_ERROR_PARSE), "Failed to parse record") == 0);
+
+    arena_destroy(&arena);
+    printf("✓ csv_push_parser errors and stopping test passed\n");
+}
+
+int main() {
+    printf("Running CSV Push Parser tests...\n\n");
+    test_csv_push_parser_chunk_boundaries();
+    test_csv_push_parser_large_input();
+    test_csv_push_parser_errors();
+    printf("\n✅ All CSV Push Parser tests passed!\n");
+    return 0;
+}
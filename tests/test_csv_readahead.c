@@ -0,0 +1,190 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "../csv_readahead.h"
+#include "../csv_buffer.h"
+
+#define TEST_FILE_SIZE (200 * 1024 + 17)
+
+static char *make_test_file(const char *filename) {
+    char *content = malloc(TEST_FILE_SIZE);
+    assert(content != NULL);
+    for (size_t i = 0; i < TEST_FILE_SIZE; i++) {
+        content[i] = (char)('a' + (i * 7 + i / 251) % 26);
+    }
+
+    FILE *file = fopen(filename, "wb");
+    assert(file != NULL);
+    fwrite(content, 1, TEST_FILE_SIZE, file);
+    fclose(file);
+    return content;
+}
+
+static size_t drain(CSVReadAhead *readahead, char *dest, size_t capacity, size_t chunk) {
+    size_t total = 0;
+    for (;;) {
+        size_t want = chunk < capacity - total ? chunk : capacity - total;
+        ssize_t n = csv_readahead_read(readahead, dest + total, want);
+        assert(n >= 0);
+        if (n == 0) break;
+        total += (size_t)n;
+    }
+    return total;
+}
+
+void test_csv_readahead_sequential() {
+    printf("Testing csv_readahead sequential reads...\n");
+    char *expected = make_test_file("test_readahead.bin");
+    char *actual = malloc(TEST_FILE_SIZE + 1);
+    assert(actual != NULL);
+
+    int fd = open("test_readahead.bin", O_RDONLY);
+    assert(fd >= 0);
+
+    size_t chunks[] = {1, 1000, 4096, 70000};
+    for (size_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) {
+        CSVReadAhead *readahead = NULL;
+        assert(csv_readahead_start(&readahead, fd, 0, 3, 4096) == CSV_READAHEAD_OK);
+        assert(drain(readahead, actual, TEST_FILE_SIZE + 1, chunks[c]) == TEST_FILE_SIZE);
+        assert(memcmp(actual, expected, TEST_FILE_SIZE) == 0);
+        assert(csv_readahead_read(readahead, actual, 16) == 0);
+
+        CSVReadAheadStats stats;
+        csv_readahead_get_stats(readahead, &stats);
+        assert(stats.bytes_read == TEST_FILE_SIZE);
+        assert(stats.buffers_filled == (TEST_FILE_SIZE + 4095) / 4096);
+        csv_readahead_stop(readahead);
+    }
+
+    CSVReadAhead *readahead = NULL;
+    assert(csv_readahead_start(&readahead, fd, 100, 0, 0) == CSV_READAHEAD_OK);
+    assert(drain(readahead, actual, TEST_FILE_SIZE, 65536) == TEST_FILE_SIZE - 100);
+    assert(memcmp(actual, expected + 100, TEST_FILE_SIZE - 100) == 0);
+    csv_readahead_stop(readahead);
+
+    assert(csv_readahead_start(NULL, fd, 0, 1, 1) == CSV_READAHEAD_ERROR_NULL_POINTER);
+    assert(csv_readahead_start(&readahead, -1, 0, 1, 1) == CSV_READAHEAD_ERROR_NULL_POINTER);
+    assert(csv_readahead_read(NULL, actual, 1) == -1);
+    csv_readahead_stop(NULL);
+
+    close(fd);
+    free(actual);
+    free(expected);
+    remove("test_readahead.bin");
+    printf("✓ csv_readahead sequential reads test passed\n");
+}
+
+void test_csv_readahead_seek() {
+    printf("Testing csv_readahead seek...\n");
+    char *expected = make_test_file("test_readahead_seek.bin");
+    char actual[5000];
+
+    int fd = open("test_readahead_seek.bin", O_RDONLY);
+    assert(fd >= 0);
+
+    CSVReadAhead *readahead = NULL;
+    assert(csv_readahead_start(&readahead, fd, 0, 2, 1024) == CSV_READAHEAD_OK);
+
+    off_t offsets[] = {150000, 3, 0, TEST_FILE_SIZE - 10, 77777};
+    for (size_t i = 0; i < sizeof(offsets) / sizeof(offsets[0]); i++) {
+        assert(csv_readahead_read(readahead, actual, 100) >= 0);
+        assert(csv_readahead_seek(readahead, offsets[i]) == CSV_READAHEAD_OK);
+
+        size_t want = sizeof(actual);
+        if ((size_t)offsets[i] + want > TEST_FILE_SIZE) want = TEST_FILE_SIZE - (size_t)offsets[i];
+        size_t got = 0;
+        while (got < want) {
+            ssize_t n = csv_readahead_read(readahead, actual + got, want - got);
+            assert(n > 0);
+            got += (size_t)n;
+        }
+        assert(memcmp(actual, expected + offsets[i], want) == 0);
+    }
+
+    assert(csv_readahead_seek(readahead, -1) == CSV_READAHEAD_ERROR_FILE_SEEK);
+    assert(csv_readahead_seek(NULL, 0) == CSV_READAHEAD_ERROR_NULL_POINTER);
+    csv_readahead_stop(readahead);
+
+    close(fd);
+    free(expected);
+    remove("test_readahead_seek.bin");
+    printf("✓ csv_readahead seek test passed\n");
+}
+
+void test_csv_readahead_pipe() {
+    printf("Testing csv_readahead on a pipe...\n");
+    int fds[2];
+    assert(pipe(fds) == 0);
+
+    const char *content = "id,name\n1,alpha\n2,beta\n";
+    assert(write(fds[1], content, strlen(content)) == (ssize_t)strlen(content));
+    close(fds[1]);
+
+    CSVReadAhead *readahead = NULL;
+    assert(csv_readahead_start(&readahead, fds[0], 0, 2, 8) == CSV_READAHEAD_OK);
+
+    char actual[64];
+    size_t got = drain(readahead, actual, sizeof(actual), 5);
+    assert(got == strlen(content));
+    assert(memcmp(actual, content, got) == 0);
+    assert(csv_readahead_seek(readahead, 0) == CSV_READAHEAD_ERROR_FILE_SEEK);
+
+    csv_readahead_stop(readahead);
+    close(fds[0]);
+    printf("✓ csv_readahead pipe test passed\n");
+}
+
+void test_csv_buffer_readahead() {
+    printf("Testing csv_buffer with read-ahead...\n");
+    FILE *file = fopen("test_readahead.csv", "wb");
+    assert(file != NULL);
+    for (int i = 0; i < 5000; i++) {
+        fprintf(file, "%d,\"quoted\nvalue %d\",plain\n", i, i);
+    }
+    fclose(file);
+
+    CSVBuffer plain;
+    CSVBuffer ahead;
+    assert(csv_buffer_open(&plain, "test_readahead.csv", 512) == CSV_BUFFER_OK);
+    assert(csv_buffer_open(&ahead, "test_readahead.csv", 512) == CSV_BUFFER_OK);
+    assert(csv_buffer_start_readahead(&ahead, 3, 700) == CSV_BUFFER_OK);
+    assert(csv_buffer_start_readahead(&ahead, 3, 700) == CSV_BUFFER_OK);
+
+    off_t mark = -1;
+    int records = 0;
+    const char *expected;
+    size_t expected_length;
+    while ((expected = csv_buffer_next_record(&plain, '"', &expected_length)) != NULL) {
+        size_t length;
+        const char *record = csv_buffer_next_record(&ahead, '"', &length);
+        assert(record && length == expected_length && memcmp(record, expected, length) == 0);
+        if (++records == 1234) mark = csv_buffer_tell(&ahead);
+    }
+    assert(records == 5000);
+    assert(csv_buffer_next_record(&ahead, '"', NULL) == NULL);
+
+    assert(csv_buffer_seek(&ahead, mark) == CSV_BUFFER_OK);
+    size_t length;
+    const char *record = csv_buffer_next_record(&ahead, '"', &length);
+    assert(record && strncmp(record, "1234,\"quoted\nvalue 1234\"", 24) == 0);
+
+    csv_buffer_close(&plain);
+    csv_buffer_close(&ahead);
+    remove("test_readahead.csv");
+    printf("✓ csv_buffer read-ahead test passed\n");
+}
+
+int main() {
+    printf("Running CSV ReadAhead tests...\n\n");
+    test_csv_readahead_sequential();
+    test_csv_readahead_seek();
+    test_csv_readahead_pipe();
+    test_csv_buffer_readahead();
+    printf("\n✅ All CSV ReadAhead tests passed!\n");
+    return 0;
+}
@@ -191,6 +191,74 @@ void test_csv_reader_seek() {
     printf("✓ csv_reader_seek test passed\n");
 }
 
+void test_csv_reader_seek_with_index() {
+    printf("Testing csv_reader_seek with a record index...\n");
+    FILE *file = fopen("test_seek_index.csv", "w");
+    assert(file != NULL);
+    fputs("id,note\n", file);
+    for (int i = 0; i < 500; i++) {
+        if (i % 9 == 0) {
+            fprintf(file, "%d,\"multi\nline\"\n", i);
+        } else {
+            fprintf(file, "%d,row\n", i);
+        }
+    }
+    fclose(file);
+    remove("test_seek_index.csv.idx");
+
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_path(config, "test_seek_index.csv");
+    csv_config_set_has_header(config, true);
+    csv_config_set_index_stride(config, 16);
+    csv_config_set_persist_index(config, true);
+
+    CSVReader *reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+    assert(!csv_index_is_built(&reader->index));
+
+    CSVRecord *record = csv_reader_next_record(reader);
+    assert(record && strcmp(record->fields[0], "0") == 0);
+
+    long targets[] = { 123, 5, 499, 16, 0, 258 };
+    for (size_t i = 0; i < sizeof(targets) / sizeof(targets[0]); i++) {
+        assert(csv_reader_seek(reader, targets[i]) == 1);
+        assert(csv_reader_get_position(reader) == targets[i] + 1);
+        record = csv_reader_next_record(reader);
+        assert(record != NULL);
+        assert(atol(record->fields[0]) == targets[i]);
+    }
+    assert(csv_index_is_built(&reader->index));
+    assert(reader->index.record_count == 500);
+    assert(csv_reader_seek(reader, 500) == 1);
+    assert(csv_reader_next_record(reader) == NULL);
+    assert(csv_reader_seek(reader, 501) == 0);
+    csv_reader_free(reader);
+
+    FILE *sidecar = fopen("test_seek_index.csv.idx", "rb");
+    assert(sidecar != NULL);
+    fclose(sidecar);
+
+    csv_config_set_reader_backend(config, CSV_READER_BACKEND_MMAP);
+    reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+    assert(csv_reader_next_record(reader) != NULL);
+    assert(csv_reader_build_index(reader) == 1);
+    assert(reader->index.stride == 16);
+    record = csv_reader_next_record(reader);
+    assert(record && strcmp(record->fields[0], "1") == 0);
+    assert(csv_reader_seek(reader, 377) == 1);
+    record = csv_reader_next_record(reader);
+    assert(record && atol(record->fields[0]) == 377);
+    csv_reader_free(reader);
+
+    arena_destroy(&arena);
+    remove("test_seek_index.csv");
+    remove("test_seek_index.csv.idx");
+    printf("✓ csv_reader_seek with a record index test passed\n");
+}
+
 void test_csv_reader_position() {
     printf("Testing csv_reader_get_position...\n");
     const char *test_content = "Name,Age\nAlice,25\nBob,30\nCharlie,35\n";
@@ -260,6 +328,414 @@ void test_csv_reader_set_config() {
     printf("✓ csv_reader_set_config test passed\n");
 }
 
+void test_csv_reader_next_record_view() {
+    printf("Testing csv_reader_next_record_view...\n");
+    const char *test_content = "Name,Quote\nAlice,\"She said \"\"hi\"\"\"\nBob,\"plain, quoted\"\n";
+    create_test_csv_file("test_record_view.csv", test_content);
+
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_path(config, "test_record_view.csv");
+    csv_config_set_has_header(config, true);
+
+    CSVReader *reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+
+    CSVRecordView *record = csv_reader_next_record_view(reader);
+    assert(record != NULL);
+    assert(record->field_count == 2);
+    assert(record->fields[0].length == 5);
+    assert(strncmp(record->fields[0].data, "Alice", 5) == 0);
+    assert(record->fields[1].needs_unescape == true);
+    assert(strcmp(csv_reader_view_field_string(reader, record, 1), "She said \"hi\"") == 0);
+    assert(csv_reader_view_field_string(reader, record, 2) == NULL);
+
+    record = csv_reader_next_record_view(reader);
+    assert(record != NULL);
+    assert(record->fields[1].needs_unescape == false);
+    assert(strncmp(record->fields[1].data, "plain, quoted", record->fields[1].length) == 0);
+
+    assert(csv_reader_next_record_view(reader) == NULL);
+    assert(csv_reader_next_record_view(NULL) == NULL);
+
+    csv_reader_free(reader);
+    arena_destroy(&arena);
+    remove("test_record_view.csv");
+    printf("✓ csv_reader_next_record_view test passed\n");
+}
+
+void test_csv_reader_mmap_backend() {
+    printf("Testing csv_reader mmap backend...\n");
+    const char *test_content = "Name,Age\nAlice,25\n\"Bob \"\"B\"\"\",30\nCharlie,35";
+    create_test_csv_file("test_mmap.csv", test_content);
+
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_path(config, "test_mmap.csv");
+    csv_config_set_has_header(config, true);
+    csv_config_set_reader_backend(config, CSV_READER_BACKEND_MMAP);
+
+    CSVReader *reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+    assert(reader->input.source == CSV_BUFFER_SOURCE_MMAP);
+    assert(reader->cached_header_count == 2);
+    assert(strcmp(reader->cached_headers[1], "Age") == 0);
+    assert(csv_reader_get_record_count(reader) == 3);
+
+    CSVRecordView *view = csv_reader_next_record_view(reader);
+    assert(view != NULL);
+    assert(view->fields[0].data >= reader->input.data);
+    assert(view->fields[0].data < reader->input.data + reader->input.end);
+    assert(strncmp(view->fields[0].data, "Alice", view->fields[0].length) == 0);
+
+    CSVRecord *record = csv_reader_next_record(reader);
+    assert(record != NULL);
+    assert(strcmp(record->fields[0], "Bob \"B\"") == 0);
+    assert(strcmp(record->fields[1], "30") == 0);
+
+    assert(csv_reader_seek(reader, 2) == 1);
+    record = csv_reader_next_record(reader);
+    assert(record != NULL);
+    assert(strcmp(record->fields[0], "Charlie") == 0);
+    assert(strcmp(record->fields[1], "35") == 0);
+    assert(csv_reader_has_next(reader) == 0);
+
+    csv_reader_rewind(reader);
+    record = csv_reader_next_record(reader);
+    assert(record != NULL && strcmp(record->fields[0], "Alice") == 0);
+
+    csv_reader_free(reader);
+
+    csv_config_set_path(config, "/dev/null");
+    csv_config_set_has_header(config, false);
+    reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+    assert(reader->input.source == CSV_BUFFER_SOURCE_READ);
+    assert(csv_reader_next_record(reader) == NULL);
+    csv_reader_free(reader);
+
+    arena_destroy(&arena);
+    remove("test_mmap.csv");
+    printf("✓ csv_reader mmap backend test passed\n");
+}
+
+void test_csv_reader_read_ahead() {
+    printf("Testing csv_reader read-ahead...\n");
+    FILE *file = fopen("test_read_ahead.csv", "w");
+    assert(file != NULL);
+    fprintf(file, "id,text\n");
+    for (int i = 0; i < 3000; i++) {
+        fprintf(file, "%d,\"row\n%d\"\n", i, i);
+    }
+    fclose(file);
+
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_path(config, "test_read_ahead.csv");
+    csv_config_set_has_header(config, true);
+    csv_config_set_read_ahead_buffers(config, 3);
+    csv_config_set_read_ahead_buffer_size(config, 1000);
+
+    CSVReader *reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+    assert(reader->input.readahead != NULL);
+    assert(reader->cached_header_count == 2);
+
+    char expected[32];
+    for (int i = 0; i < 3000; i++) {
+        CSVRecord *record = csv_reader_next_record(reader);
+        assert(record != NULL && record->field_count == 2);
+        snprintf(expected, sizeof(expected), "row\n%d", i);
+        assert(atoi(record->fields[0]) == i);
+        assert(strcmp(record->fields[1], expected) == 0);
+    }
+    assert(csv_reader_next_record(reader) == NULL);
+
+    CSVReadAheadStats stats;
+    assert(csv_reader_get_read_ahead_stats(reader, &stats));
+    assert(stats.bytes_read > 0 && stats.buffers_filled > 0);
+
+    assert(csv_reader_seek(reader, 1500) == 1);
+    CSVRecord *record = csv_reader_next_record(reader);
+    assert(record != NULL && strcmp(record->fields[1], "row\n1500") == 0);
+
+    csv_reader_rewind(reader);
+    record = csv_reader_next_record(reader);
+    assert(record != NULL && strcmp(record->fields[1], "row\n0") == 0);
+    csv_reader_free(reader);
+
+    csv_config_set_read_ahead_buffers(config, 0);
+    reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+    assert(!csv_reader_get_read_ahead_stats(reader, &stats));
+    assert(stats.bytes_read == 0);
+    csv_reader_free(reader);
+
+    arena_destroy(&arena);
+    remove("test_read_ahead.csv");
+    printf("✓ csv_reader read-ahead test passed\n");
+}
+
+void test_csv_reader_projection() {
+    printf("Testing csv_reader projection...\n");
+    const char *test_content = "id,name,city,age\n1,Alice,\"Paris, FR\",25\n2,Bob\n3,\"Carol \"\"C\"\"\",Rome,40\n";
+    create_test_csv_file("test_projection.csv", test_content);
+
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_path(config, "test_projection.csv");
+    csv_config_set_has_header(config, true);
+
+    CSVReader *reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+
+    const char *names[] = {"age", "name"};
+    assert(csv_reader_set_projection(reader, names, 2) == 1);
+
+    CSVRecord *record = csv_reader_next_record(reader);
+    assert(record != NULL && record->field_count == 2);
+    assert(strcmp(record->fields[0], "25") == 0);
+    assert(strcmp(record->fields[1], "Alice") == 0);
+
+    record = csv_reader_next_record(reader);
+    assert(record != NULL && record->field_count == 2);
+    assert(strcmp(record->fields[0], "") == 0);
+    assert(strcmp(record->fields[1], "Bob") == 0);
+
+    CSVRecordView *view = csv_reader_next_record_view(reader);
+    assert(view != NULL && view->field_count == 2);
+    assert(strcmp(csv_reader_view_field_string(reader, view, 0), "40") == 0);
+    assert(strcmp(csv_reader_view_field_string(reader, view, 1), "Carol \"C\"") == 0);
+
+    int indices[] = {2};
+    assert(csv_reader_set_projection_indices(reader, indices, 1) == 1);
+    csv_reader_rewind(reader);
+    record = csv_reader_next_record(reader);
+    assert(record != NULL && record->field_count == 1);
+    assert(strcmp(record->fields[0], "Paris, FR") == 0);
+
+    const char *unknown[] = {"name", "missing"};
+    const char *duplicate[] = {"name", "name"};
+    int out_of_range[] = {4};
+    assert(csv_reader_set_projection(reader, unknown, 2) == 0);
+    assert(csv_reader_set_projection(reader, duplicate, 2) == 0);
+    assert(csv_reader_set_projection_indices(reader, out_of_range, 1) == 0);
+    assert(csv_reader_set_projection(NULL, names, 2) == 0);
+    assert(reader->projection.output_count == 1);
+
+    assert(csv_reader_set_projection(reader, NULL, 0) == 1);
+    csv_reader_rewind(reader);
+    record = csv_reader_next_record(reader);
+    assert(record != NULL && record->field_count == 4);
+    csv_reader_clear_projection(NULL);
+
+    csv_reader_free(reader);
+    arena_destroy(&arena);
+    remove("test_projection.csv");
+    printf("✓ csv_reader projection test passed\n");
+}
+
+void test_csv_reader_next_records() {
+    printf("Testing csv_reader_next_records...\n");
+    FILE *file = fopen("test_batch.csv", "w");
+    assert(file != NULL);
+    fprintf(file, "id,text,extra\n");
+    for (int i = 0; i < 2500; i++) {
+        fprintf(file, "%d,\"text \"\"%d\"\"\",x\n", i, i);
+    }
+    fclose(file);
+
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_path(config, "test_batch.csv");
+    csv_config_set_has_header(config, true);
+
+    CSVReader *reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+
+    CSVRecordBatch batch;
+    assert(csv_record_batch_init(&batch, 1000));
+
+    int next_id = 0;
+    size_t sizes[] = {1000, 1000, 500};
+    char expected[32];
+    for (size_t b = 0; b < 3; b++) {
+        assert(csv_reader_next_records(reader, &batch, 5000) == sizes[b]);
+        assert(batch.count == sizes[b]);
+        for (size_t i = 0; i < batch.count; i++, next_id++) {
+            CSVRecord *record = &batch.records[i];
+            assert(record->field_count == 3);
+            assert(atoi(record->fields[0]) == next_id);
+            snprintf(expected, sizeof(expected), "text \"%d\"", next_id);
+            assert(strcmp(record->fields[1], expected) == 0);
+        }
+    }
+    assert(csv_reader_next_records(reader, &batch, 1000) == 0);
+    assert(csv_reader_get_position(reader) == 2501);
+
+    const char *columns[] = {"text"};
+    assert(csv_reader_set_projection(reader, columns, 1) == 1);
+    assert(csv_reader_set_filter(reader, csv_predicate_prefix(&arena, 0, "24")) == 1);
+    csv_reader_rewind(reader);
+    assert(csv_reader_next_records(reader, &batch, 7) == 7);
+    assert(batch.records[0].field_count == 1);
+    assert(strcmp(batch.records[0].fields[0], "text \"24\"") == 0);
+    assert(strcmp(batch.records[1].fields[0], "text \"240\"") == 0);
+    assert(csv_reader_next_records(reader, &batch, 1000) == 104);
+
+    csv_reader_set_filter(reader, NULL);
+    csv_reader_clear_projection(reader);
+    assert(csv_reader_seek(reader, 2498) == 1);
+    assert(csv_reader_next_records(reader, &batch, 10) == 2);
+    CSVRecord *record = csv_reader_next_record(reader);
+    assert(record == NULL);
+    assert(batch.error == NULL);
+    csv_reader_free(reader);
+
+    /* A bad record ends its batch and stops later ones instead of being skipped. */
+    file = fopen("test_batch.csv", "w");
+    assert(file != NULL);
+    fprintf(file, "id,text\n1,a\n2,b\n3,\"x\"y\n4,d\n5,e\n");
+    fclose(file);
+    reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+    assert(csv_reader_next_records(reader, &batch, 10) == 2);
+    assert(batch.error != NULL && batch.error_line == 4 && batch.error_column > 0);
+    assert(strcmp(batch.records[1].fields[1], "b") == 0);
+    assert(csv_reader_next_records(reader, &batch, 10) == 0);
+    assert(csv_reader_next_records(reader, &batch, 10) == 0);
+    batch.error = NULL;
+    assert(csv_reader_next_records(reader, &batch, 10) == 2);
+    assert(strcmp(batch.records[0].fields[0], "4") == 0 && batch.error == NULL);
+
+    assert(csv_reader_next_records(NULL, &batch, 10) == 0);
+    assert(csv_reader_next_records(reader, NULL, 10) == 0);
+    assert(!csv_record_batch_init(NULL, 10));
+    assert(!csv_record_batch_init(&batch, 0));
+    csv_record_batch_free(&batch);
+    csv_record_batch_free(NULL);
+
+    csv_reader_free(reader);
+    arena_destroy(&arena);
+    remove("test_batch.csv");
+    printf("✓ csv_reader_next_records test passed\n");
+}
+
+void test_csv_reader_next_column_batch() {
+    printf("Testing csv_reader_next_column_batch...\n");
+    FILE *file = fopen("test_columns.csv", "w");
+    assert(file != NULL);
+    fprintf(file, "id,text,extra\n");
+    for (int i = 0; i < 1500; i++) {
+        if (i == 7) {
+            fprintf(file, "%d\n", i);
+        } else {
+            fprintf(file, "%d,\"text \"\"%d\"\"\",x,ignored\n", i, i);
+        }
+    }
+    fclose(file);
+
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_path(config, "test_columns.csv");
+    csv_config_set_has_header(config, true);
+
+    CSVReader *reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+
+    CSVColumnBatch batch;
+    assert(csv_column_batch_init(&batch, 1000));
+
+    int next_id = 0;
+    size_t sizes[] = {1000, 500};
+    char expected[32];
+    size_t length;
+    for (size_t b = 0; b < 2; b++) {
+        assert(csv_reader_next_column_batch(reader, &batch, 5000) == sizes[b]);
+        assert(batch.row_count == sizes[b] && batch.column_count == 3);
+        assert(strcmp(batch.names[1], "text") == 0);
+        assert(batch.columns[0].offsets[0] == 0);
+        for (size_t row = 0; row < batch.row_count; row++, next_id++) {
+            const char *id = csv_column_batch_value(&batch, 0, row, &length);
+            snprintf(expected, sizeof(expected), "%d", next_id);
+            assert(length == strlen(expected) && memcmp(id, expected, length) == 0);
+
+            const char *text = csv_column_batch_value(&batch, 1, row, &length);
+            if (next_id == 7) {
+                assert(length == 0);
+                continue;
+            }
+            snprintf(expected, sizeof(expected), "text \"%d\"", next_id);
+            assert(length == strlen(expected) && memcmp(text, expected, length) == 0);
+        }
+        CSVColumn *extra = &batch.columns[2];
+        assert(extra->offsets[batch.row_count] == extra->data_size);
+    }
+    assert(csv_reader_next_column_batch(reader, &batch, 1000) == 0);
+    assert(batch.row_count == 0);
+
+    const char *columns[] = {"text", "id"};
+    assert(csv_reader_set_projection(reader, columns, 2) == 1);
+    assert(csv_reader_set_filter(reader, csv_predicate_prefix(&arena, 0, "14")) == 1);
+    csv_reader_rewind(reader);
+    assert(csv_reader_next_column_batch(reader, &batch, 1000) == 111);
+    assert(batch.column_count == 2);
+    assert(strcmp(batch.names[0], "text") == 0 && strcmp(batch.names[1], "id") == 0);
+    const char *text = csv_column_batch_value(&batch, 0, 1, &length);
+    assert(length == 10 && memcmp(text, "text \"140\"", length) == 0);
+    assert(csv_column_batch_value(&batch, 2, 0, &length) == NULL && length == 0);
+    assert(csv_column_batch_value(&batch, 0, 111, NULL) == NULL);
+    csv_reader_set_filter(reader, NULL);
+    csv_reader_clear_projection(reader);
+    csv_reader_free(reader);
+
+    csv_config_set_has_header(config, false);
+    reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+    assert(csv_reader_next_column_batch(reader, &batch, 2) == 2);
+    assert(batch.column_count == 4 && batch.names[0] == NULL && batch.names[3] == NULL);
+    text = csv_column_batch_value(&batch, 2, 0, &length);
+    assert(length == 5 && memcmp(text, "extra", length) == 0);
+    assert(csv_column_batch_value(&batch, 3, 0, &length) != NULL && length == 0);
+    text = csv_column_batch_value(&batch, 3, 1, &length);
+    assert(length == 7 && memcmp(text, "ignored", length) == 0);
+    csv_reader_free(reader);
+
+    /* A bad row ends its batch and stops later ones instead of being skipped. */
+    file = fopen("test_columns.csv", "w");
+    assert(file != NULL);
+    fprintf(file, "1,a\n2,b,c\n3,\"x\"y\n4,d\n");
+    fclose(file);
+    reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+    assert(csv_reader_next_column_batch(reader, &batch, 10) == 2);
+    assert(batch.column_count == 3 && batch.error != NULL && batch.error_line == 3);
+    assert(csv_column_batch_value(&batch, 2, 0, &length) != NULL && length == 0);
+    assert(csv_reader_next_column_batch(reader, &batch, 10) == 0);
+    batch.error = NULL;
+    assert(csv_reader_next_column_batch(reader, &batch, 10) == 1);
+    text = csv_column_batch_value(&batch, 0, 0, &length);
+    assert(length == 1 && text[0] == '4' && batch.column_count == 2);
+
+    assert(csv_reader_next_column_batch(NULL, &batch, 10) == 0);
+    assert(csv_reader_next_column_batch(reader, NULL, 10) == 0);
+    assert(!csv_column_batch_init(NULL, 10));
+    assert(!csv_column_batch_init(&batch, 0));
+    csv_column_batch_free(&batch);
+    csv_column_batch_free(NULL);
+
+    csv_reader_free(reader);
+    arena_destroy(&arena);
+    remove("test_columns.csv");
+    printf("✓ csv_reader_next_column_batch test passed\n");
+}
+
 void test_csv_reader_null_safety() {
     printf("Testing csv_reader null safety...\n");
     
@@ -363,6 +839,168 @@ void test_csv_reader_get_record_count() {
     printf("✓ csv_reader_get_record_count test passed\n");
 }
 
+void test_csv_reader_many_records() {
+    printf("Testing csv_reader across buffer refills...\n");
+    FILE *file = fopen("test_many_records.csv", "w");
+    assert(file != NULL);
+    fputs("id,text\r\n", file);
+    for (int i = 0; i < 20000; i++) {
+        if (i % 100 == 0) {
+            fprintf(file, "%d,\"line\nbreak, \"\"%d\"\"\"\r\n", i, i);
+        } else {
+            fprintf(file, "%d,value_%d\r\n", i, i);
+        }
+    }
+    fclose(file);
+
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_path(config, "test_many_records.csv");
+    csv_config_set_has_header(config, true);
+
+    CSVReader *reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+    assert(reader->cached_header_count == 2);
+    assert(strcmp(reader->cached_headers[1], "text") == 0);
+
+    char expected[64];
+    for (int i = 0; i < 20000; i++) {
+        CSVRecord *record = csv_reader_next_record(reader);
+        assert(record != NULL);
+        assert(record->field_count == 2);
+        assert(atoi(record->fields[0]) == i);
+        if (i % 100 == 0) {
+            snprintf(expected, sizeof(expected), "line\nbreak, \"%d\"", i);
+        } else {
+            snprintf(expected, sizeof(expected), "value_%d", i);
+        }
+        assert(strcmp(record->fields[1], expected) == 0);
+    }
+    assert(csv_reader_next_record(reader) == NULL);
+    size_t persistent_used = arena_get_used_size(reader->persistent_arena);
+    assert(csv_reader_get_record_count(reader) == 20000);
+    assert(arena_get_used_size(reader->persistent_arena) == persistent_used);
+
+    csv_reader_free(reader);
+    arena_destroy(&arena);
+    remove("test_many_records.csv");
+    printf("✓ csv_reader across buffer refills test passed\n");
+}
+
+void test_csv_reader_oversized_records() {
+    printf("Testing csv_reader with records larger than its arenas...\n");
+    const size_t wide_fields = 1000000;
+    const size_t long_length = 3 * 1024 * 1024;
+    FILE *file = fopen("test_oversized.csv", "w");
+    assert(file != NULL);
+    for (size_t i = 0; i < wide_fields; i++) {
+        fputs(i ? ",x" : "x", file);
+    }
+    fputs("\nhead,\"", file);
+    for (size_t i = 0; i < long_length; i++) {
+        fputc(i % 80 == 79 ? '\n' : 'y', file);
+    }
+    fputs("\",tail\nlast,row\n", file);
+    fclose(file);
+
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_path(config, "test_oversized.csv");
+    csv_config_set_has_header(config, false);
+
+    CSVReader *reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+
+    CSVRecord *record = csv_reader_next_record(reader);
+    assert(record != NULL);
+    assert(record->field_count == wide_fields);
+    assert(strcmp(record->fields[wide_fields - 1], "x") == 0);
+
+    record = csv_reader_next_record(reader);
+    assert(record != NULL);
+    assert(record->field_count == 3);
+    assert(strlen(record->fields[1]) == long_length);
+    assert(strcmp(record->fields[2], "tail") == 0);
+
+    record = csv_reader_next_record(reader);
+    assert(record != NULL);
+    assert(strcmp(record->fields[1], "row") == 0);
+    assert(csv_reader_next_record(reader) == NULL);
+
+    csv_reader_free(reader);
+    arena_destroy(&arena);
+    remove("test_oversized.csv");
+    printf("✓ csv_reader oversized records test passed\n");
+}
+
+void test_csv_reader_unquoted_fast_path() {
+    printf("Testing csv_reader unquoted fast path...\n");
+    FILE *file = fopen("test_unquoted.csv", "w");
+    assert(file != NULL);
+    fputs("id,name,note\n", file);
+    for (int i = 0; i < 8000; i++) {
+        if (i == 7000) {
+            fputs("7000,\"late, quoted\",\"two\nlines\"\n", file);
+        } else {
+            fprintf(file, "%d,name %d,  note\t%d,\n", i, i, i);
+        }
+    }
+    fclose(file);
+
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_path(config, "test_unquoted.csv");
+    CSVConfig *full = csv_config_copy(&arena, config);
+    csv_config_set_quoting(full, CSV_QUOTING_FULL);
+
+    CSVReader *reader = csv_reader_init_standalone(config);
+    CSVReader *expected = csv_reader_init_standalone(full);
+    assert(reader != NULL && expected != NULL);
+    assert(reader->parser->unquoted && !expected->parser->unquoted);
+
+    for (int pass = 0; pass < 2; pass++) {
+        int rows = 0;
+        CSVRecord *want;
+        while ((want = csv_reader_next_record(expected)) != NULL) {
+            CSVRecordView *got = csv_reader_next_record_view(reader);
+            assert(got != NULL && got->field_count == want->field_count);
+            for (size_t i = 0; i < want->field_count; i++) {
+                assert(strcmp(csv_reader_view_field_string(reader, got, i), want->fields[i]) == 0);
+            }
+            assert(reader->parser->unquoted == (rows < 7000));
+            rows++;
+        }
+        assert(rows == 8000 && csv_reader_next_record_view(reader) == NULL);
+
+        /* Rewinding samples the start of the file again. */
+        csv_reader_rewind(reader);
+        csv_reader_rewind(expected);
+        assert(reader->parser->unquoted);
+    }
+    csv_reader_free(reader);
+    csv_reader_free(expected);
+
+    csv_config_set_quoting(config, CSV_QUOTING_NONE);
+    csv_config_set_has_header(config, false);
+    file = fopen("test_unquoted.csv", "w");
+    assert(file != NULL);
+    fputs("\"a,b\",c\nd,e\n", file);
+    fclose(file);
+    reader = csv_reader_init_standalone(config);
+    assert(reader != NULL && reader->parser->unquoted);
+    CSVRecord *record = csv_reader_next_record(reader);
+    assert(record != NULL && record->field_count == 2);
+    assert(strcmp(record->fields[0], "a,b") == 0 && !reader->parser->unquoted);
+    csv_reader_free(reader);
+
+    arena_destroy(&arena);
+    remove("test_unquoted.csv");
+    printf("✓ csv_reader unquoted fast path test passed\n");
+}
+
 int main() {
     printf("Running CSV Reader tests...\n\n");
     test_csv_reader_optimized();
@@ -370,10 +1008,20 @@ int main() {
     test_csv_reader_rewind();
     test_csv_reader_has_next();
     test_csv_reader_seek();
+    test_csv_reader_seek_with_index();
     test_csv_reader_position();
     test_csv_reader_set_config();
     test_csv_reader_get_record_count();
+    test_csv_reader_many_records();
+    test_csv_reader_oversized_records();
+    test_csv_reader_next_record_view();
+    test_csv_reader_mmap_backend();
+    test_csv_reader_read_ahead();
+    test_csv_reader_projection();
+    test_csv_reader_next_records();
+    test_csv_reader_next_column_batch();
     test_csv_reader_null_safety();
+    test_csv_reader_unquoted_fast_path();
     printf("\n✅ All CSV Reader tests passed!\n");
     return 0;
 } 
\ No newline at end of file
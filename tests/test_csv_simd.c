@@ -0,0 +1,151 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <pthread.h>
+#include "../csv_simd.h"
+
+static void expected_masks(const char *block, char delimiter, char enclosure, CSVStructuralMasks *masks) {
+    memset(masks, 0, sizeof(*masks));
+    for (int i = 0; i < CSV_SIMD_BLOCK_SIZE; i++) {
+        if (block[i] == delimiter) masks->delimiter |= (uint64_t)1 << i;
+        if (block[i] == enclosure) masks->enclosure |= (uint64_t)1 << i;
+        if (block[i] == '\n' || block[i] == '\r') masks->newline |= (uint64_t)1 << i;
+    }
+}
+
+static void* index_first_blocks(void *arg) {
+    const char *block = arg;
+    CSVStructuralMasks expected;
+    expected_masks(block, ',', '"', &expected);
+    for (int i = 0; i < 1000; i++) {
+        CSVStructuralMasks masks;
+        csv_simd_index_block(block, ',', '"', &masks);
+        assert(masks.delimiter == expected.delimiter && masks.enclosure == expected.enclosure);
+        assert(masks.newline == expected.newline);
+    }
+    return NULL;
+}
+
+/* Must run before anything else touches the level, so every thread races to initialize it. */
+void test_csv_simd_concurrent_first_use() {
+    printf("Testing csv_simd first use from several threads...\n");
+    char block[CSV_SIMD_BLOCK_SIZE];
+    for (int i = 0; i < CSV_SIMD_BLOCK_SIZE; i++) {
+        block[i] = "a,\"\n"[i % 4];
+    }
+
+    pthread_t threads[8];
+    for (int i = 0; i < 8; i++) {
+        assert(pthread_create(&threads[i], NULL, index_first_blocks, block) == 0);
+    }
+    for (int i = 0; i < 8; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    CSVSimdLevel detected = csv_simd_detect_level();
+    assert(csv_simd_get_level() == (detected > CSV_SIMD_SCALAR ? detected : CSV_SIMD_DISABLED));
+    printf("✓ csv_simd concurrent first use test passed\n");
+}
+
+void test_csv_simd_levels() {
+    printf("Testing csv_simd level selection...\n");
+
+    CSVSimdLevel detected = csv_simd_detect_level();
+    assert(detected >= CSV_SIMD_SCALAR);
+    if (detected > CSV_SIMD_SCALAR) {
+        assert(csv_simd_get_level() == detected);
+    } else {
+        assert(csv_simd_get_level() == CSV_SIMD_DISABLED);
+    }
+
+    assert(csv_simd_set_level(CSV_SIMD_SCALAR) == CSV_SIMD_SCALAR);
+    assert(csv_simd_get_level() == CSV_SIMD_SCALAR);
+    assert(csv_simd_set_level(CSV_SIMD_AVX2) == detected || detected < CSV_SIMD_AVX2);
+    assert(csv_simd_set_level(CSV_SIMD_DISABLED) == CSV_SIMD_DISABLED);
+
+    assert(strcmp(csv_simd_level_string(CSV_SIMD_SCALAR), "scalar") == 0);
+    assert(strcmp(csv_simd_level_string(CSV_SIMD_AVX2), "avx2") == 0);
+
+    csv_simd_set_level(detected);
+    printf("✓ csv_simd level selection test passed (%s)\n", csv_simd_level_string(detected));
+}
+
+void test_csv_simd_index_block() {
+    printf("Testing csv_simd_index_block...\n");
+    const char *block = "a,\"b,c\",d\r\n"
+                        "e,f,\"g\"\"h\"\n"
+                        ";;;\t\t\t,,,\"\"\"\n"
+                        "0123456789abcdefghijklmnopqr,";
+    assert(strlen(block) == CSV_SIMD_BLOCK_SIZE);
+
+    CSVStructuralMasks expected;
+    expected_masks(block, ',', '"', &expected);
+
+    CSVSimdLevel detected = csv_simd_detect_level();
+    for (int level = CSV_SIMD_SCALAR; level <= (int)detected; level++) {
+        csv_simd_set_level((CSVSimdLevel)level);
+        CSVStructuralMasks masks;
+        csv_simd_index_block(block, ',', '"', &masks);
+        assert(masks.delimiter == expected.delimiter);
+        assert(masks.enclosure == expected.enclosure);
+        assert(masks.newline == expected.newline);
+    }
+
+    csv_simd_set_level(detected);
+    printf("✓ csv_simd_index_block test passed\n");
+}
+
+void test_csv_simd_index_block_random() {
+    printf("Testing csv_simd_index_block against random input...\n");
+    const char alphabet[] = "ab,;\"'\n\r\t \x80\xff";
+    char block[CSV_SIMD_BLOCK_SIZE];
+    CSVSimdLevel detected = csv_simd_detect_level();
+
+    srand(42);
+    for (int iteration = 0; iteration < 2000; iteration++) {
+        for (int i = 0; i < CSV_SIMD_BLOCK_SIZE; i++) {
+            block[i] = alphabet[rand() % (sizeof(alphabet) - 1)];
+        }
+        char delimiter = (iteration & 1) ? ';' : ',';
+        char enclosure = (iteration & 2) ? '\'' : '"';
+
+        CSVStructuralMasks expected;
+        expected_masks(block, delimiter, enclosure, &expected);
+
+        for (int level = CSV_SIMD_SCALAR; level <= (int)detected; level++) {
+            csv_simd_set_level((CSVSimdLevel)level);
+            CSVStructuralMasks masks;
+            csv_simd_index_block(block, delimiter, enclosure, &masks);
+            assert(masks.delimiter == expected.delimiter);
+            assert(masks.enclosure == expected.enclosure);
+            assert(masks.newline == expected.newline);
+        }
+    }
+
+    csv_simd_set_level(detected);
+    printf("✓ csv_simd_index_block random input test passed\n");
+}
+
+void test_csv_simd_prefix_xor() {
+    printf("Testing csv_simd_prefix_xor...\n");
+
+    assert(csv_simd_prefix_xor(0) == 0);
+    assert(csv_simd_prefix_xor(1) == ~(uint64_t)0);
+    assert(csv_simd_prefix_xor(0x9) == 0x7);
+    assert(csv_simd_prefix_xor(((uint64_t)1 << 2) | ((uint64_t)1 << 5)) == 0x1C);
+    assert(csv_simd_prefix_xor((uint64_t)1 << 63) == (uint64_t)1 << 63);
+
+    printf("✓ csv_simd_prefix_xor test passed\n");
+}
+
+int main() {
+    printf("Running CSV SIMD tests...\n\n");
+    test_csv_simd_concurrent_first_use();
+    test_csv_simd_levels();
+    test_csv_simd_index_block();
+    test_csv_simd_index_block_random();
+    test_csv_simd_prefix_xor();
+    printf("\n✅ All CSV SIMD tests passed!\n");
+    return 0;
+}
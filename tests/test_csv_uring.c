@@ -0,0 +1,190 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "../csv_uring.h"
+#include "../csv_reader.h"
+#include "../arena.h"
+
+#define TEST_FILE_SIZE (300 * 1024 + 5)
+
+static char *make_test_file(const char *filename) {
+    char *content = malloc(TEST_FILE_SIZE);
+    assert(content != NULL);
+    for (size_t i = 0; i < TEST_FILE_SIZE; i++) {
+        content[i] = (char)('A' + (i * 13 + i / 509) % 26);
+    }
+
+    FILE *file = fopen(filename, "wb");
+    assert(file != NULL);
+    fwrite(content, 1, TEST_FILE_SIZE, file);
+    fclose(file);
+    return content;
+}
+
+void test_csv_uring_read_and_seek() {
+    printf("Testing csv_uring reads and seeks...\n");
+    if (!csv_uring_available()) {
+        printf("  io_uring unavailable, checking fallback result only\n");
+        CSVUring *uring = NULL;
+        assert(csv_uring_open(&uring, 0, 0, 4, 4096) == CSV_URING_ERROR_UNSUPPORTED);
+        assert(uring == NULL);
+        printf("✓ csv_uring reads and seeks test passed\n");
+        return;
+    }
+
+    char *expected = make_test_file("test_uring.bin");
+    char *actual = malloc(TEST_FILE_SIZE);
+    assert(actual != NULL);
+    int fd = open("test_uring.bin", O_RDONLY);
+    assert(fd >= 0);
+
+    size_t chunks[] = {1, 3000, 8192, 100000};
+    for (size_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) {
+        CSVUring *uring = NULL;
+        assert(csv_uring_open(&uring, fd, 0, 4, 8192) == CSV_URING_OK);
+
+        size_t total = 0;
+        for (;;) {
+            size_t want = chunks[c] < TEST_FILE_SIZE - total ? chunks[c] : TEST_FILE_SIZE - total;
+            ssize_t n = csv_uring_read(uring, actual + total, want ? want : 1);
+            assert(n >= 0);
+            if (n == 0) break;
+            total += (size_t)n;
+        }
+        assert(total == TEST_FILE_SIZE);
+        assert(memcmp(actual, expected, TEST_FILE_SIZE) == 0);
+        assert(csv_uring_read(uring, actual, 16) == 0);
+
+        CSVReadAheadStats stats;
+        csv_uring_get_stats(uring, &stats);
+        assert(stats.bytes_read == TEST_FILE_SIZE);
+        assert(stats.buffers_filled >= TEST_FILE_SIZE / 8192);
+        csv_uring_close(uring);
+    }
+
+    CSVUring *uring = NULL;
+    assert(csv_uring_open(&uring, fd, 0, 3, 4096) == CSV_URING_OK);
+    off_t offsets[] = {250000, 7, TEST_FILE_SIZE - 3, 0, 123456};
+    for (size_t i = 0; i < sizeof(offsets) / sizeof(offsets[0]); i++) {
+        assert(csv_uring_read(uring, actual, 50) >= 0);
+        assert(csv_uring_seek(uring, offsets[i]) == CSV_URING_OK);
+
+        size_t want = 20000;
+        if ((size_t)offsets[i] + want > TEST_FILE_SIZE) want = TEST_FILE_SIZE - (size_t)offsets[i];
+        size_t got = 0;
+        while (got < want) {
+            ssize_t n = csv_uring_read(uring, actual + got, want - got);
+            assert(n > 0);
+            got += (size_t)n;
+        }
+        assert(memcmp(actual, expected + offsets[i], want) == 0);
+    }
+    assert(csv_uring_seek(uring, -1) == CSV_URING_ERROR_FILE_SEEK);
+    csv_uring_close(uring);
+
+    close(fd);
+    free(actual);
+    free(expected);
+    remove("test_uring.bin");
+    printf("✓ csv_uring reads and seeks test passed\n");
+}
+
+void test_csv_uring_unsupported_inputs() {
+    printf("Testing csv_uring unsupported inputs...\n");
+    int fds[2];
+    assert(pipe(fds) == 0);
+
+    CSVUring *uring = NULL;
+    assert(csv_uring_open(&uring, fds[0], 0, 4, 4096) == CSV_URING_ERROR_UNSUPPORTED);
+    assert(uring == NULL);
+    assert(csv_uring_open(NULL, fds[0], 0, 4, 4096) == CSV_URING_ERROR_NULL_POINTER);
+    assert(csv_uring_open(&uring, -1, 0, 4, 4096) == CSV_URING_ERROR_NULL_POINTER);
+    assert(csv_uring_read(NULL, (char*)fds, 1) == -1);
+    assert(csv_uring_seek(NULL, 0) == CSV_URING_ERROR_NULL_POINTER);
+    assert(!csv_uring_uses_registered_buffers(NULL));
+    csv_uring_close(NULL);
+
+    close(fds[0]);
+    close(fds[1]);
+    printf("✓ csv_uring unsupported inputs test passed\n");
+}
+
+void test_csv_reader_uring_backend() {
+    printf("Testing csv_reader io_uring backend...\n");
+    FILE *file = fopen("test_uring.csv", "w");
+    assert(file != NULL);
+    fprintf(file, "id,text\n");
+    for (int i = 0; i < 4000; i++) {
+        fprintf(file, "%d,\"line\n%d\"\n", i, i);
+    }
+    fclose(file);
+
+    Arena arena;
+    assert(arena_create(&arena, 4096) == ARENA_OK);
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_path(config, "test_uring.csv");
+    csv_config_set_has_header(config, true);
+    csv_config_set_reader_backend(config, CSV_READER_BACKEND_IO_URING);
+    csv_config_set_read_ahead_buffers(config, 4);
+    csv_config_set_read_ahead_buffer_size(config, 2048);
+
+    CSVReader *reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+    assert(reader->input.source == CSV_BUFFER_SOURCE_READ);
+    if (csv_uring_available()) {
+        assert(reader->input.uring != NULL);
+    } else {
+        assert(reader->input.uring == NULL);
+    }
+    assert(reader->cached_header_count == 2);
+
+    char expected[32];
+    for (int i = 0; i < 4000; i++) {
+        CSVRecord *record = csv_reader_next_record(reader);
+        assert(record != NULL && record->field_count == 2);
+        snprintf(expected, sizeof(expected), "line\n%d", i);
+        assert(atoi(record->fields[0]) == i);
+        assert(strcmp(record->fields[1], expected) == 0);
+    }
+    assert(csv_reader_next_record(reader) == NULL);
+
+    CSVReadAheadStats stats;
+    if (reader->input.uring) {
+        assert(csv_reader_get_read_ahead_stats(reader, &stats));
+        assert(stats.bytes_read > 0);
+    }
+
+    assert(csv_reader_seek(reader, 2500) == 1);
+    CSVRecord *record = csv_reader_next_record(reader);
+    assert(record != NULL && strcmp(record->fields[1], "line\n2500") == 0);
+    csv_reader_rewind(reader);
+    record = csv_reader_next_record(reader);
+    assert(record != NULL && strcmp(record->fields[1], "line\n0") == 0);
+    csv_reader_free(reader);
+
+    csv_config_set_path(config, "/dev/null");
+    csv_config_set_has_header(config, false);
+    reader = csv_reader_init_standalone(config);
+    assert(reader != NULL);
+    assert(reader->input.uring == NULL);
+    assert(csv_reader_next_record(reader) == NULL);
+    csv_reader_free(reader);
+
+    arena_destroy(&arena);
+    remove("test_uring.csv");
+    printf("✓ csv_reader io_uring backend test passed\n");
+}
+
+int main() {
+    printf("Running CSV io_uring tests...\n\n");
+    test_csv_uring_read_and_seek();
+    test_csv_uring_unsupported_inputs();
+    test_csv_reader_uring_backend();
+    printf("\n✅ All CSV io_uring tests passed!\n");
+    return 0;
+}
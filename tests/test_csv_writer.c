@@ -1,7 +1,12 @@
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <time.h>
+#include <signal.h>
+#include <unistd.h>
 #include "../csv_writer.h"
 #include "../csv_config.h"
 #include "../arena.h"
@@ -196,6 +201,78 @@ void test_csv_writer_write_record_map() {
     printf("✓ csv_writer_write_record_map test passed\n");
 }
 
+void test_csv_writer_wide_record_map_and_plan() {
+    printf("Testing csv_writer wide record maps and field plans...\n");
+    Arena arena;
+    assert(arena_create(&arena, 1024 * 1024) == ARENA_OK);
+
+    enum { WIDTH = 400 };
+    static char names[WIDTH][16];
+    static char values[WIDTH][16];
+    char *headers[WIDTH];
+    char *keys[WIDTH + 1];
+    char *row[WIDTH + 1];
+    for (int i = 0; i < WIDTH; i++) {
+        snprintf(names[i], sizeof(names[i]), "c%d", i);
+        snprintf(values[i], sizeof(values[i]), "v%d", i);
+        headers[i] = names[i];
+        keys[i] = names[WIDTH - 1 - i];
+        row[i] = values[WIDTH - 1 - i];
+    }
+    keys[WIDTH] = "unknown";
+    row[WIDTH] = "ignored";
+
+    FILE *file = tmpfile();
+    assert(file != NULL);
+    CSVConfig *config = csv_config_create(&arena);
+    CSVWriter *writer;
+    assert(csv_writer_init_with_file(&writer, file, config, headers, WIDTH, &arena) == CSV_WRITER_OK);
+
+    assert(csv_writer_write_record_map(writer, keys, row, WIDTH + 1) == CSV_WRITER_OK);
+    size_t used = arena_get_used_size(&arena);
+    assert(csv_writer_write_record_map(writer, keys + 1, row + 1, WIDTH - 1) == CSV_WRITER_OK);
+    assert(arena_get_used_size(&arena) == used);
+
+    CSVWriterFieldPlan *plan = NULL;
+    assert(csv_writer_compile_plan(writer, keys, WIDTH + 1, &plan) == CSV_WRITER_OK);
+    assert(plan != NULL && plan->field_count == WIDTH + 1);
+    assert(plan->columns[0] == WIDTH - 1 && plan->columns[WIDTH] == -1);
+    used = arena_get_used_size(&arena);
+    for (int i = 0; i < 3; i++) {
+        assert(csv_writer_write_record_plan(writer, plan, row) == CSV_WRITER_OK);
+    }
+    assert(arena_get_used_size(&arena) == used);
+
+    assert(csv_writer_compile_plan(NULL, keys, 1, &plan) == CSV_WRITER_ERROR_NULL_POINTER);
+    assert(csv_writer_compile_plan(writer, NULL, 1, &plan) == CSV_WRITER_ERROR_NULL_POINTER);
+    assert(csv_writer_write_record_plan(writer, NULL, row) == CSV_WRITER_ERROR_NULL_POINTER);
+    assert(csv_writer_flush(writer) == CSV_WRITER_OK);
+
+    rewind(file);
+    static char line[WIDTH * 12];
+    assert(fgets(line, sizeof(line), file) != NULL);
+    assert(strncmp(line, "c0,c1,c2,", 9) == 0);
+    for (int record = 0; record < 5; record++) {
+        assert(fgets(line, sizeof(line), file) != NULL);
+        char *field = strtok(line, ",\n");
+        for (int i = 0; i < WIDTH; i++) {
+            bool dropped = record == 1 && i == WIDTH - 1;
+            if (dropped) {
+                assert(field == NULL);
+                break;
+            }
+            assert(field != NULL && strcmp(field, values[i]) == 0);
+            field = strtok(NULL, ",\n");
+        }
+    }
+    assert(fgets(line, sizeof(line), file) == NULL);
+
+    csv_writer_free(writer);
+    fclose(file);
+    arena_destroy(&arena);
+    printf("✓ csv_writer wide record maps and field plans test passed\n");
+}
+
 void test_csv_writer_custom_delimiter() {
     printf("Testing csv_writer with custom delimiter...\n");
     
@@ -480,6 +557,265 @@ void test_csv_writer_line_endings() {
     printf("✓ csv_writer line endings test passed\n");
 }
 
+static size_t read_whole_file(FILE *file, char *buffer, size_t size) {
+    rewind(file);
+    size_t bytes_read = fread(buffer, 1, size - 1, file);
+    buffer[bytes_read] = '\0';
+    return bytes_read;
+}
+
+void test_csv_writer_buffered_output() {
+    printf("Testing csv_writer buffered output...\n");
+    
+    Arena arena;
+    assert(arena_create(&arena, 1024 * 1024) == ARENA_OK);
+    
+    FILE *file = tmpfile();
+    FILE *expected_file = tmpfile();
+    assert(file != NULL && expected_file != NULL);
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_auto_flush(config, false);
+    fputs("# preamble\n", file);
+    fputs("# preamble\n", expected_file);
+    
+    char *headers[] = {"id", "text", "quoted"};
+    CSVWriter *writer;
+    assert(csv_writer_init_with_file(&writer, file, config, headers, 3, &arena) == CSV_WRITER_OK);
+    
+    FieldWriteOptions options = { .delimiter = ',', .enclosure = '"', .escape = '"' };
+    char long_field[CSV_WRITER_BUFFER_SIZE + 100];
+    memset(long_field, 'L', sizeof(long_field) - 1);
+    long_field[sizeof(long_field) - 1] = '\0';
+    long_field[500] = '"';
+    long_field[CSV_WRITER_BUFFER_SIZE] = '"';
+    
+    fputs("id,text,quoted\n", expected_file);
+    char id[32];
+    char text[64];
+    for (int i = 0; i < 5000; i++) {
+        snprintf(id, sizeof(id), "%d", i);
+        snprintf(text, sizeof(text), "value %d, \"%d\"\nline", i, i * 7);
+        char *quoted = (i == 2500) ? long_field : (i % 3 == 0 ? "" : "say \"\"hi\"\"");
+        char *record[] = {id, text, quoted};
+        assert(csv_writer_write_record(writer, record, 3) == CSV_WRITER_OK);
+        
+        for (int f = 0; f < 3; f++) {
+            if (f > 0) fputc(',', expected_file);
+            options.field = record[f];
+            assert(write_field(expected_file, &options) == CSV_WRITER_OK);
+        }
+        fputc('\n', expected_file);
+    }
+    
+    assert(writer->buffer_used > 0);
+    assert(csv_writer_flush(writer) == CSV_WRITER_OK);
+    assert(writer->buffer_used == 0);
+    
+    size_t size = 1024 * 1024;
+    char *actual = malloc(size);
+    char *expected = malloc(size);
+    assert(actual != NULL && expected != NULL);
+    size_t actual_length = read_whole_file(file, actual, size);
+    size_t expected_length = read_whole_file(expected_file, expected, size);
+    assert(actual_length == expected_length);
+    assert(memcmp(actual, expected, actual_length) == 0);
+    
+    char *tail[] = {"tail", "", ""};
+    assert(csv_writer_write_record(writer, tail, 3) == CSV_WRITER_OK);
+    csv_writer_free(writer);
+    actual_length = read_whole_file(file, actual, size);
+    assert(strcmp(actual + actual_length - strlen("tail,,\n"), "tail,,\n") == 0);
+    
+    free(actual);
+    free(expected);
+    fclose(file);
+    fclose(expected_file);
+    arena_destroy(&arena);
+    printf("✓ csv_writer buffered output test passed\n");
+}
+
+void test_csv_writer_flush_policy() {
+    printf("Testing csv_writer flush policy...\n");
+    char contents[64];
+    
+    Arena arena;
+    assert(arena_create(&arena, 1024 * 1024) == ARENA_OK);
+    char *record[] = {"1234567", "abcdefg"};
+    CSVWriter *writer;
+    
+    FILE *file = tmpfile();
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_flush_records(config, 3);
+    assert(csv_writer_init_with_file(&writer, file, config, NULL, 0, &arena) == CSV_WRITER_OK);
+    assert(csv_writer_write_record(writer, record, 2) == CSV_WRITER_OK);
+    assert(csv_writer_write_record(writer, record, 2) == CSV_WRITER_OK);
+    assert(writer->buffer_used == 32);
+    assert(csv_writer_write_record(writer, record, 2) == CSV_WRITER_OK);
+    assert(writer->buffer_used == 0);
+    csv_writer_free(writer);
+    fclose(file);
+    
+    file = tmpfile();
+    csv_config_set_flush_records(config, 0);
+    csv_config_set_flush_bytes(config, 40);
+    csv_config_set_sync_on_flush(config, true);
+    assert(csv_writer_init_with_file(&writer, file, config, NULL, 0, &arena) == CSV_WRITER_OK);
+    assert(csv_writer_write_record(writer, record, 2) == CSV_WRITER_OK);
+    assert(csv_writer_write_record(writer, record, 2) == CSV_WRITER_OK);
+    assert(writer->buffer_used == 32);
+    assert(csv_writer_write_record(writer, record, 2) == CSV_WRITER_OK);
+    assert(writer->buffer_used == 0);
+    assert(csv_writer_flush(writer) == CSV_WRITER_OK);
+    csv_writer_free(writer);
+    fclose(file);
+    
+    file = tmpfile();
+    csv_config_set_flush_bytes(config, 0);
+    csv_config_set_sync_on_flush(config, false);
+    csv_config_set_flush_interval_ms(config, 20);
+    assert(csv_writer_init_with_file(&writer, file, config, NULL, 0, &arena) == CSV_WRITER_OK);
+    assert(csv_writer_write_record(writer, record, 2) == CSV_WRITER_OK);
+    assert(writer->buffer_used == 16);
+    struct timespec pause = {0, 30 * 1000 * 1000};
+    nanosleep(&pause, NULL);
+    assert(csv_writer_write_record(writer, record, 2) == CSV_WRITER_OK);
+    assert(writer->buffer_used == 0);
+
+    /* An idle producer relies on polling to push out the last rows. */
+    assert(csv_writer_write_record(writer, record, 2) == CSV_WRITER_OK);
+    assert(csv_writer_poll(writer) == CSV_WRITER_OK);
+    assert(writer->buffer_used == 16);
+    nanosleep(&pause, NULL);
+    assert(csv_writer_poll(writer) == CSV_WRITER_OK);
+    assert(writer->buffer_used == 0);
+    assert(read_whole_file(file, contents, sizeof(contents)) == 48);
+    assert(csv_writer_poll(NULL) == CSV_WRITER_ERROR_NULL_POINTER);
+    csv_writer_free(writer);
+    fclose(file);
+
+    file = tmpfile();
+    csv_config_set_flush_interval_ms(config, 0);
+    csv_config_set_flush_bytes(config, 100 * 1024);
+    assert(csv_writer_init_with_file(&writer, file, config, NULL, 0, &arena) == CSV_WRITER_OK);
+    assert(writer->buffer_size >= 100 * 1024);
+    for (int i = 0; i < 5000; i++) {
+        assert(csv_writer_write_record(writer, record, 2) == CSV_WRITER_OK);
+    }
+    assert(writer->buffer_used == 5000 * 16);
+    csv_writer_free(writer);
+    fclose(file);
+    csv_config_set_flush_bytes(config, 0);
+    
+    file = tmpfile();
+    csv_config_set_auto_flush(config, false);
+    csv_config_set_flush_records(config, 1);
+    assert(csv_writer_init_with_file(&writer, file, config, NULL, 0, &arena) == CSV_WRITER_OK);
+    assert(csv_writer_write_record(writer, record, 2) == CSV_WRITER_OK);
+    assert(csv_writer_write_record(writer, record, 2) == CSV_WRITER_OK);
+    assert(writer->buffer_used == 32);
+    csv_writer_free(writer);
+    assert(read_whole_file(file, contents, sizeof(contents)) == 32);
+    fclose(file);
+    
+    arena_destroy(&arena);
+    printf("✓ csv_writer flush policy test passed\n");
+}
+
+static void write_numbered_records(CSVWriter *writer, int count) {
+    char id[32];
+    char text[64];
+    for (int i = 0; i < count; i++) {
+        snprintf(id, sizeof(id), "%d", i);
+        snprintf(text, sizeof(text), "row \"%d\", async", i);
+        char *record[] = {id, text};
+        assert(csv_writer_write_record(writer, record, 2) == CSV_WRITER_OK);
+    }
+}
+
+void test_csv_writer_async() {
+    printf("Testing csv_writer async mode...\n");
+    
+    Arena arena;
+    assert(arena_create(&arena, 1024 * 1024) == ARENA_OK);
+    char *headers[] = {"id", "text"};
+    CSVWriter *writer;
+    size_t size = 2 * 1024 * 1024;
+    char *expected = malloc(size);
+    char *actual = malloc(size);
+    assert(expected != NULL && actual != NULL);
+    
+    FILE *expected_file = tmpfile();
+    CSVConfig *config = csv_config_create(&arena);
+    csv_config_set_auto_flush(config, false);
+    assert(csv_writer_init_with_file(&writer, expected_file, config, headers, 2, &arena) == CSV_WRITER_OK);
+    write_numbered_records(writer, 30000);
+    assert(csv_writer_free(writer) == CSV_WRITER_OK);
+    size_t expected_length = read_whole_file(expected_file, expected, size);
+    fclose(expected_file);
+    
+    FILE *file = tmpfile();
+    csv_config_set_async_write(config, true);
+    assert(csv_writer_init_with_file(&writer, file, config, headers, 2, &arena) == CSV_WRITER_OK);
+    assert(writer->async != NULL);
+    write_numbered_records(writer, 30000);
+    assert(csv_writer_flush(writer) == CSV_WRITER_OK);
+    assert(read_whole_file(file, actual, size) == expected_length);
+    assert(memcmp(actual, expected, expected_length) == 0);
+    
+    char *tail[] = {"tail", "end"};
+    assert(csv_writer_write_record(writer, tail, 2) == CSV_WRITER_OK);
+    assert(csv_writer_free(writer) == CSV_WRITER_OK);
+    size_t actual_length = read_whole_file(file, actual, size);
+    assert(actual_length == expected_length + strlen("tail,end\n"));
+    fclose(file);
+
+    /* The default autoFlush hands buffers over as they fill, not once per record. */
+    file = tmpfile();
+    csv_config_set_auto_flush(config, true);
+    assert(csv_writer_init_with_file(&writer, file, config, headers, 2, &arena) == CSV_WRITER_OK);
+    write_numbered_records(writer, 30000);
+    assert(writer->async_handoffs > 0 && writer->async_handoffs < 30000 / 100);
+    assert(csv_writer_flush(writer) == CSV_WRITER_OK);
+    assert(read_whole_file(file, actual, size) == expected_length);
+    assert(memcmp(actual, expected, expected_length) == 0);
+    assert(csv_writer_free(writer) == CSV_WRITER_OK);
+    fclose(file);
+
+    /* A threshold marks a handoff as due; it happens once the thread is free. */
+    file = tmpfile();
+    csv_config_set_flush_records(config, 100);
+    assert(csv_writer_init_with_file(&writer, file, config, headers, 2, &arena) == CSV_WRITER_OK);
+    write_numbered_records(writer, 30000);
+    assert(writer->async_handoffs > 0 && writer->async_handoffs <= 30000 / 100);
+    assert(csv_writer_free(writer) == CSV_WRITER_OK);
+    assert(read_whole_file(file, actual, size) == expected_length);
+    assert(memcmp(actual, expected, expected_length) == 0);
+    fclose(file);
+    csv_config_set_flush_records(config, 0);
+    
+    int fds[2];
+    assert(pipe(fds) == 0);
+    signal(SIGPIPE, SIG_IGN);
+    close(fds[0]);
+    FILE *broken = fdopen(fds[1], "w");
+    assert(broken != NULL);
+    assert(csv_writer_init_with_file(&writer, broken, config, NULL, 0, &arena) == CSV_WRITER_OK);
+    CSVWriterResult result = CSV_WRITER_OK;
+    for (int i = 0; i < 100000 && result == CSV_WRITER_OK; i++) {
+        result = csv_writer_write_record(writer, tail, 2);
+    }
+    assert(result == CSV_WRITER_ERROR_FILE_WRITE);
+    assert(csv_writer_write_record(writer, tail, 2) == CSV_WRITER_ERROR_FILE_WRITE);
+    assert(csv_writer_free(writer) == CSV_WRITER_ERROR_FILE_WRITE);
+    fclose(broken);
+    signal(SIGPIPE, SIG_DFL);
+    
+    free(expected);
+    free(actual);
+    arena_destroy(&arena);
+    printf("✓ csv_writer async mode test passed\n");
+}
+
 int main() {
     printf("Running CSV Writer Tests...\n\n");
     
@@ -489,6 +825,7 @@ int main() {
     test_csv_writer_write_record();
     test_csv_writer_write_record_with_quotes();
     test_csv_writer_write_record_map();
+    test_csv_writer_wide_record_map_and_plan();
     test_csv_writer_custom_delimiter();
     test_csv_writer_custom_enclosure();
     test_field_needs_quoting();
@@ -498,6 +835,9 @@ int main() {
     test_is_numeric_field();
     test_csv_writer_encoding_support();
     test_csv_writer_line_endings();
+    test_csv_writer_buffered_output();
+    test_csv_writer_flush_policy();
+    test_csv_writer_async();
     
     printf("\n✅ All CSV Writer tests passed!\n");
     return 0;